@@ -91,6 +91,7 @@ protected:
 
 void BasicApp::setup()
 {
+	// DebugExtension tracks allocations without locking, skip it when updating with a SkeletonUpdateScheduler.
 	dbgExtension = new DebugExtension(SpineExtension::getInstance());
 
 	SpineExtension::setInstance(dbgExtension);
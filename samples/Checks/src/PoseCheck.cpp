@@ -0,0 +1,185 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Runs the sample skeletons in lockstep through three updates of the world transforms and checks that the results are
+// identical: the plain update, which applies the update cache bone by bone, Skeleton::updateWorldTransform(), which
+// batches the bones in the SkeletonPose, and the incremental update, see Skeleton::setIncrementalUpdate(). Build from
+// this directory with eg:
+//   g++ -std=c++11 -O2 -I../../../src/spine-cpp/include PoseCheck.cpp ../../../src/spine-cpp/src/spine/*.cpp
+// and pass the assets directory if it is not ../../Basic/assets/. Compilers that fuse multiply adds, eg with
+// -ffp-contract=fast, may make the batched world transforms differ in the last bits.
+
+#include <spine/spine.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		return new DefaultSpineExtension();
+	}
+}
+
+static const int frameCount = 1200;
+
+// The update before batching: applied transforms are reset to the local transforms, then the update cache is applied.
+static void updateWorldTransformPlain(Skeleton &skeleton) {
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = 0, n = bones.size(); i < n; i++) {
+		Bone *bone = bones[i];
+		bone->setAX(bone->getX());
+		bone->setAY(bone->getY());
+		bone->setAppliedRotation(bone->getRotation());
+		bone->setAScaleX(bone->getScaleX());
+		bone->setAScaleY(bone->getScaleY());
+		bone->setAShearX(bone->getShearX());
+		bone->setAShearY(bone->getShearY());
+	}
+	Vector<Updatable *> &updateCache = skeleton.getUpdateCacheList();
+	for (size_t i = 0, n = updateCache.size(); i < n; i++)
+		updateCache[i]->update();
+}
+
+static void getTransforms(Bone &bone, float *values) {
+	values[0] = bone.getA();
+	values[1] = bone.getB();
+	values[2] = bone.getC();
+	values[3] = bone.getD();
+	values[4] = bone.getWorldX();
+	values[5] = bone.getWorldY();
+	values[6] = bone.getAX();
+	values[7] = bone.getAY();
+	values[8] = bone.getAppliedRotation();
+	values[9] = bone.getAScaleX();
+	values[10] = bone.getAScaleY();
+	values[11] = bone.getAShearX();
+	values[12] = bone.getAShearY();
+}
+
+// Returns the number of active bones whose world or applied transform differs bitwise.
+static int compare(Skeleton &expected, Skeleton &actual, const char *name, int frame) {
+	int differences = 0;
+	Vector<Bone *> &bones = expected.getBones();
+	for (size_t i = 0, n = bones.size(); i < n; i++) {
+		if (!bones[i]->isActive()) continue;
+		float expectedValues[13], actualValues[13];
+		getTransforms(*bones[i], expectedValues);
+		getTransforms(*actual.getBones()[i], actualValues);
+		if (!memcmp(expectedValues, actualValues, sizeof(expectedValues))) continue;
+		if (!differences)
+			printf("  %s differs at frame %d, bone %s\n", name, frame, bones[i]->getData().getName().buffer());
+		differences++;
+	}
+	return differences;
+}
+
+// Changes the animations, constraints and bones of all skeletons the same way at some frames, then updates them.
+static void step(Skeleton **skeletons, AnimationState **states, int frame) {
+	SkeletonData *data = skeletons[0]->getData();
+	Vector<Animation *> &animations = data->getAnimations();
+	for (int i = 0; i < 3; i++) {
+		Skeleton &skeleton = *skeletons[i];
+		AnimationState &state = *states[i];
+		if (frame % 200 == 0) state.setAnimation(0, animations[(frame / 200) % animations.size()], true);
+		if (frame == 100) state.setEmptyAnimation(0, 0.3f);
+		if (frame == 300 && skeleton.getIkConstraints().size()) skeleton.getIkConstraints()[0]->setMix(0.5f);
+		if (frame == 500) skeleton.setPosition(10, 20);
+		if (frame >= 700 && frame < 900) state.clearTracks();
+		if (frame == 800) skeleton.setBonesToSetupPose();
+		if (frame == 850) skeleton.getBones()[skeleton.getBones().size() > 1 ? 1 : 0]->setRotation(33);
+		state.update(1 / 60.0f);
+		state.apply(skeleton);
+	}
+	updateWorldTransformPlain(*skeletons[0]);
+	skeletons[1]->updateWorldTransform();
+	skeletons[2]->updateWorldTransform();
+}
+
+static bool check(const std::string &assets, const char *atlasFile, const char *skeletonFile) {
+	Atlas atlas((assets + atlasFile).c_str(), NULL, false);
+	SkeletonJson json(&atlas);
+	SkeletonData *data = json.readSkeletonDataFile((assets + skeletonFile).c_str());
+	if (!data) {
+		printf("%-24s %s\n", skeletonFile, json.getError().buffer());
+		return false;
+	}
+	AnimationStateData stateData(data);
+	stateData.setDefaultMix(0.2f);
+
+	Skeleton plain(data), batched(data), incremental(data);
+	incremental.setIncrementalUpdate(true);
+	Skeleton *skeletons[] = {&plain, &batched, &incremental};
+	AnimationState plainState(&stateData), batchedState(&stateData), incrementalState(&stateData);
+	AnimationState *states[] = {&plainState, &batchedState, &incrementalState};
+	if (data->getSkins().size() > 1) {
+		for (int i = 0; i < 3; i++) {
+			skeletons[i]->setSkin(data->getSkins()[1]);
+			skeletons[i]->setSlotsToSetupPose();
+		}
+	}
+
+	int batchedDifferences = 0, incrementalDifferences = 0;
+	size_t skipped = 0;
+	for (int frame = 0; frame < frameCount; frame++) {
+		step(skeletons, states, frame);
+		batchedDifferences += compare(plain, batched, "batched", frame);
+		incrementalDifferences += compare(plain, incremental, "incremental", frame);
+		skipped += incremental.getSkippedBoneCount();
+	}
+	printf("%-24s %3zu bones  batched %s  incremental %s, skipped %.1f%%\n", skeletonFile, plain.getBones().size(),
+		   batchedDifferences ? "DIFFERS" : "ok", incrementalDifferences ? "DIFFERS" : "ok",
+		   100.0 * skipped / ((double) frameCount * plain.getBones().size()));
+	delete data;
+	return !batchedDifferences && !incrementalDifferences;
+}
+
+int main(int argc, char **argv) {
+	std::string assets = argc > 1 ? argv[1] : "../../Basic/assets/";
+	if (assets[assets.size() - 1] != '/') assets += '/';
+
+	const char *skeletons[][2] = {
+			{"coin-pma.atlas", "coin-pro.json"},
+			{"dragon-pma.atlas", "dragon-ess.json"},
+			{"goblins-pma.atlas", "goblins-pro.json"},
+			{"mix-and-match-pma.atlas", "mix-and-match-pro.json"},
+			{"owl-pma.atlas", "owl-pro.json"},
+			{"raptor-pma.atlas", "raptor-pro.json"},
+			{"spineboy-pma.atlas", "spineboy-pro.json"},
+			{"stretchyman-pma.atlas", "stretchyman-pro.json"},
+			{"tank-pma.atlas", "tank-pro.json"},
+			{"vine-pma.atlas", "vine-pro.json"}};
+	bool ok = true;
+	for (size_t i = 0; i < sizeof(skeletons) / sizeof(skeletons[0]); i++)
+		ok &= check(assets, skeletons[i][0], skeletons[i][1]);
+	printf("%s\n", ok ? "passed" : "FAILED");
+	return ok ? 0 : 1;
+}
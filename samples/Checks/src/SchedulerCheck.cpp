@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Runs the sample skeletons in lockstep through SkeletonDrawable::update() and a SkeletonUpdateScheduler with a
+// single thread, with and without an update interval, and checks that the bones and bounds are identical. Also checks
+// that SkeletonUpdateScheduler::updateWorldTransform() matches Skeleton::updateWorldTransform(). Links the
+// Cinder backend, so build from this directory against Cinder with eg:
+//   g++ -std=c++14 -O2 -I<cinder>/include -I../../../src -I../../../src/spine-cpp/include SchedulerCheck.cpp
+//       ../../../src/spine/spine-cinder.cpp ../../../src/spine-cpp/src/spine/*.cpp -L<cinder>/lib -lcinder
+// and pass the assets directory if it is not ../../Basic/assets/.
+
+#include <spine/spine-cinder.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+using namespace spine;
+
+static const int frameCount = 1200;
+
+static void getTransforms(Bone &bone, float *values) {
+	values[0] = bone.getA();
+	values[1] = bone.getB();
+	values[2] = bone.getC();
+	values[3] = bone.getD();
+	values[4] = bone.getWorldX();
+	values[5] = bone.getWorldY();
+}
+
+// Adds the number of active bones whose world transform differs bitwise to differences, counting differing bounds as
+// one more. Reports the first difference.
+static void compare(SkeletonDrawable &expected, SkeletonDrawable &actual, const char *name, int frame,
+					int &differences) {
+	Vector<Bone *> &bones = expected.skeleton->getBones();
+	for (size_t i = 0, n = bones.size(); i < n; i++) {
+		if (!bones[i]->isActive()) continue;
+		float expectedValues[6], actualValues[6];
+		getTransforms(*bones[i], expectedValues);
+		getTransforms(*actual.skeleton->getBones()[i], actualValues);
+		if (!memcmp(expectedValues, actualValues, sizeof(expectedValues))) continue;
+		if (!differences)
+			printf("  %s differs at frame %d, bone %s\n", name, frame, bones[i]->getData().getName().buffer());
+		differences++;
+	}
+	if (expected.bounds->getWidth() != actual.bounds->getWidth() ||
+		expected.bounds->getHeight() != actual.bounds->getHeight()) {
+		if (!differences) printf("  %s differs at frame %d, bounds\n", name, frame);
+		differences++;
+	}
+}
+
+static void setAnimation(SkeletonDrawable **drawables, int count, int frame) {
+	Vector<Animation *> &animations = drawables[0]->skeleton->getData()->getAnimations();
+	for (int i = 0; i < count; i++) {
+		if (frame % 200 == 0) drawables[i]->state->setAnimation(0, animations[(frame / 200) % animations.size()], true);
+		if (frame == 100) drawables[i]->state->setEmptyAnimation(0, 0.3f);
+	}
+}
+
+static bool check(const std::string &assets, const char *atlasFile, const char *skeletonFile) {
+	Atlas atlas((assets + atlasFile).c_str(), NULL, false);
+	SkeletonJson json(&atlas);
+	SkeletonData *data = json.readSkeletonDataFile((assets + skeletonFile).c_str());
+	if (!data) {
+		printf("%-24s %s\n", skeletonFile, json.getError().buffer());
+		return false;
+	}
+	AnimationStateData stateData(data);
+	stateData.setDefaultMix(0.2f);
+
+	// Each pair is updated by the drawable and by the scheduler, the second pair every third frame. The world
+	// transforms of the last pair are computed by the skeleton and group by group by the scheduler.
+	SkeletonDrawable updated(data, &stateData), scheduled(data, &stateData);
+	SkeletonDrawable updatedInterval(data, &stateData), scheduledInterval(data, &stateData);
+	updatedInterval.setUpdateInterval(3, 1);
+	scheduledInterval.setUpdateInterval(3, 1);
+	SkeletonDrawable grouped(data, &stateData), ungrouped(data, &stateData);
+	SkeletonDrawable *drawables[] = {&updated, &scheduled, &updatedInterval, &scheduledInterval, &grouped, &ungrouped};
+
+	SkeletonUpdateScheduler scheduler(1);
+	scheduler.add(&scheduled);
+	scheduler.add(&scheduledInterval);
+
+	int differences = 0, intervalDifferences = 0, groupDifferences = 0;
+	for (int frame = 0; frame < frameCount; frame++) {
+		setAnimation(drawables, 6, frame);
+		updated.update(1 / 60.0f);
+		updatedInterval.update(1 / 60.0f);
+		scheduler.update(1 / 60.0f);
+		compare(updated, scheduled, "scheduled", frame, differences);
+		compare(updatedInterval, scheduledInterval, "scheduled with interval", frame, intervalDifferences);
+
+		ungrouped.state->update(1 / 60.0f);
+		ungrouped.state->apply(*ungrouped.skeleton);
+		ungrouped.skeleton->updateWorldTransform();
+		grouped.state->update(1 / 60.0f);
+		grouped.state->apply(*grouped.skeleton);
+		scheduler.updateWorldTransform(*grouped.skeleton);
+		compare(ungrouped, grouped, "groups", frame, groupDifferences);
+	}
+	printf("%-24s %3zu bones  scheduled %s  with interval %s  groups %s\n", skeletonFile, data->getBones().size(),
+		   differences ? "DIFFERS" : "ok", intervalDifferences ? "DIFFERS" : "ok", groupDifferences ? "DIFFERS" : "ok");
+	delete data;
+	return !differences && !intervalDifferences && !groupDifferences;
+}
+
+int main(int argc, char **argv) {
+	std::string assets = argc > 1 ? argv[1] : "../../Basic/assets/";
+	if (assets[assets.size() - 1] != '/') assets += '/';
+
+	const char *skeletons[][2] = {
+			{"coin-pma.atlas", "coin-pro.json"},
+			{"dragon-pma.atlas", "dragon-ess.json"},
+			{"goblins-pma.atlas", "goblins-pro.json"},
+			{"mix-and-match-pma.atlas", "mix-and-match-pro.json"},
+			{"owl-pma.atlas", "owl-pro.json"},
+			{"raptor-pma.atlas", "raptor-pro.json"},
+			{"spineboy-pma.atlas", "spineboy-pro.json"},
+			{"stretchyman-pma.atlas", "stretchyman-pro.json"},
+			{"tank-pma.atlas", "tank-pro.json"},
+			{"vine-pma.atlas", "vine-pro.json"}};
+	bool ok = true;
+	for (size_t i = 0; i < sizeof(skeletons) / sizeof(skeletons[0]); i++)
+		ok &= check(assets, skeletons[i][0], skeletons[i][1]);
+	printf("%s\n", ok ? "passed" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Times sinDeg and cosDeg, sinCosDeg and the batched sinCosDeg with the C library and in the fast trig mode, see
+// MathUtil::setFastTrig(). Build from this directory with eg:
+//   g++ -std=c++11 -O2 -I../../../src/spine-cpp/include TrigBenchmark.cpp ../../../src/spine-cpp/src/spine/*.cpp
+
+#include <spine/Extension.h>
+#include <spine/MathUtil.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		return new DefaultSpineExtension();
+	}
+}
+
+enum Mode {
+	Mode_SinDegCosDeg,
+	Mode_SinCosDeg,
+	Mode_Batched
+};
+
+static const int angleCount = 4096;
+static const int repeats = 500;
+static const int runs = 9;
+
+static float sum;
+
+// Returns the median time of the runs in nanoseconds per angle.
+static double measure(Mode mode, std::vector<float> &angles, std::vector<float> &sines, std::vector<float> &cosines) {
+	std::vector<double> times;
+	for (int run = 0; run < runs; run++) {
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		for (int repeat = 0; repeat < repeats; repeat++) {
+			switch (mode) {
+				case Mode_SinDegCosDeg:
+					for (int i = 0; i < angleCount; i++) {
+						sines[i] = MathUtil::sinDeg(angles[i]);
+						cosines[i] = MathUtil::cosDeg(angles[i]);
+					}
+					break;
+				case Mode_SinCosDeg:
+					for (int i = 0; i < angleCount; i++)
+						MathUtil::sinCosDeg(angles[i], sines[i], cosines[i]);
+					break;
+				case Mode_Batched:
+					MathUtil::sinCosDeg(angles.data(), sines.data(), cosines.data(), angleCount);
+					break;
+			}
+			sum += sines[repeat % angleCount] + cosines[repeat % angleCount];
+		}
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+		times.push_back(elapsed.count() / ((double) repeats * angleCount));
+	}
+	std::sort(times.begin(), times.end());
+	return times[runs / 2];
+}
+
+int main() {
+	// Angles as bone rotations and shears produce them, mostly within a few turns.
+	std::vector<float> angles(angleCount), sines(angleCount), cosines(angleCount);
+	for (int i = 0; i < angleCount; i++)
+		angles[i] = i * 0.37f - 700;
+
+	const char *names[] = {"sinDeg + cosDeg", "sinCosDeg", "sinCosDeg batched"};
+	printf("%-18s %10s %10s\n", "ns per angle", "C library", "fast");
+	for (int mode = Mode_SinDegCosDeg; mode <= Mode_Batched; mode++) {
+		MathUtil::setFastTrig(false);
+		double library = measure((Mode) mode, angles, sines, cosines);
+		MathUtil::setFastTrig(true);
+		double fast = measure((Mode) mode, angles, sines, cosines);
+		printf("%-18s %10.2f %10.2f\n", names[mode], library, fast);
+	}
+	return sum == 12345 ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks the accuracy of the fast trig mode, see MathUtil::setFastTrig(). Sweeps sinDeg, cosDeg, sinCosDeg and the
+// batched sinCosDeg against the C library evaluated in double precision and fails when the error exceeds the
+// documented bound. Build from this directory with eg:
+//   g++ -std=c++11 -O2 -I../../../src/spine-cpp/include TrigCheck.cpp ../../../src/spine-cpp/src/spine/*.cpp
+
+#include <spine/Extension.h>
+#include <spine/MathUtil.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		return new DefaultSpineExtension();
+	}
+}
+
+// The bound stated in the MathUtil::setFastTrig() docs.
+static const double maxError = 4e-7;
+
+// Angles at and beyond this use the C library.
+static const float maxFastDegrees = 4194304.0f;
+
+struct Result {
+	double error;
+	float worstAngle;
+	size_t count;
+	size_t failures;
+
+	Result() : error(0), worstAngle(0), count(0), failures(0) {
+	}
+
+	void add(float degrees, float sine, float cosine) {
+		double radians = (double) degrees * (3.14159265358979323846 / 180);
+		double e = fabs(sine - sin(radians)), ec = fabs(cosine - cos(radians));
+		if (ec > e) e = ec;
+		if (!(e <= maxError)) failures++;
+		if (e > error) {
+			error = e;
+			worstAngle = degrees;
+		}
+		count++;
+	}
+
+	bool report(const char *name) {
+		printf("%-22s %10zu angles  max error %.3g at %.9g  %s\n", name, count, error, worstAngle,
+			   failures ? "FAILED" : "ok");
+		return failures == 0;
+	}
+};
+
+static float nextAngle(float degrees, int steps) {
+	unsigned int bits;
+	memcpy(&bits, &degrees, sizeof(bits));
+	bits += steps;
+	memcpy(&degrees, &bits, sizeof(bits));
+	return degrees;
+}
+
+// Fills the angles of the sweep: every 1/1024 degree within two turns, then every float up to the fast limit taken
+// with a stride that gives about a million angles per binade, both signs.
+static void sweep(std::vector<float> &angles) {
+	for (int i = -720 * 1024; i <= 720 * 1024; i++)
+		angles.push_back(i / 1024.0f);
+	for (float binade = 1; binade < maxFastDegrees; binade *= 2) {
+		for (float degrees = binade; degrees < binade * 2; degrees = nextAngle(degrees, 7)) {
+			angles.push_back(degrees);
+			angles.push_back(-degrees);
+		}
+	}
+}
+
+int main() {
+	MathUtil::setFastTrig(true);
+	std::vector<float> angles;
+	sweep(angles);
+
+	Result scalar, sinCos, batched;
+	size_t mismatches = 0;
+	for (size_t i = 0; i < angles.size(); i++) {
+		float degrees = angles[i], sine, cosine;
+		MathUtil::sinCosDeg(degrees, sine, cosine);
+		sinCos.add(degrees, sine, cosine);
+		float sineDeg = MathUtil::sinDeg(degrees), cosineDeg = MathUtil::cosDeg(degrees);
+		scalar.add(degrees, sineDeg, cosineDeg);
+		if (sineDeg != sine || cosineDeg != cosine) mismatches++;
+	}
+
+	// Odd batch sizes so the tails after the SIMD lanes are covered too.
+	std::vector<float> sines(angles.size()), cosines(angles.size());
+	for (size_t i = 0, count = 1; i < angles.size(); i += count, count = count % 37 + 1) {
+		if (i + count > angles.size()) count = angles.size() - i;
+		MathUtil::sinCosDeg(&angles[i], &sines[i], &cosines[i], count);
+	}
+	size_t batchedDiffers = 0;
+	for (size_t i = 0; i < angles.size(); i++) {
+		batched.add(angles[i], sines[i], cosines[i]);
+		float sine, cosine;
+		MathUtil::sinCosDeg(angles[i], sine, cosine);
+		if (sines[i] != sine || cosines[i] != cosine) batchedDiffers++;
+	}
+
+	bool ok = scalar.report("sinDeg, cosDeg");
+	ok &= sinCos.report("sinCosDeg");
+	ok &= batched.report("sinCosDeg batched");
+	printf("sinDeg and cosDeg differ from sinCosDeg for %zu angles\n", mismatches);
+	printf("batched sinCosDeg differs from sinCosDeg for %zu angles\n", batchedDiffers);
+	ok &= mismatches == 0;
+	printf("%s, bound %.3g\n", ok ? "passed" : "FAILED", maxError);
+	return ok ? 0 : 1;
+}
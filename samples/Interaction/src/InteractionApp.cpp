@@ -92,6 +92,7 @@ protected:
 
 void InteractionApp::setup()
 {
+	// DebugExtension tracks allocations without locking, skip it when updating with a SkeletonUpdateScheduler.
 	dbgExtension = new DebugExtension(SpineExtension::getInstance());
 
 	SpineExtension::setInstance(dbgExtension);
@@ -38,6 +38,8 @@
 #include <spine/SpineString.h>
 #include <spine/Property.h>
 
+#include <stdint.h>
+
 namespace spine {
 	class Timeline;
 
@@ -47,6 +49,23 @@ namespace spine {
 
 	class AnimationState;
 
+	class SkeletonData;
+
+	class BakedAnimation;
+
+	class BatchedTimelines;
+
+	/// The kinds of timelines that AnimationState applies differently from the others, see
+	/// Animation::getTimelineKinds().
+	enum TimelineKind {
+		TimelineKind_Other = 0,
+		TimelineKind_Rotate,
+		TimelineKind_Attachment,
+		TimelineKind_DrawOrder,
+		TimelineKind_Deform,
+		TimelineKind_Event
+	};
+
 	class SP_API Animation : public SpineObject {
 		friend class AnimationState;
 
@@ -54,6 +73,8 @@ namespace spine {
 
 		friend class AnimationStateData;
 
+		friend class SkeletonData;
+
 		friend class AttachmentTimeline;
 
 		friend class RGBATimeline;
@@ -101,7 +122,8 @@ namespace spine {
 
 		~Animation();
 
-		/// Applies all the animation's timelines to the specified skeleton.
+		/// Applies all the animation's timelines to the specified skeleton, the grouped bone timelines first when the
+		/// animation is batched.
 		/// See also Timeline::apply(Skeleton&, float, float, Vector, float, MixPose, MixDirection)
 		void apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents, float alpha,
 				   MixBlend blend, MixDirection direction);
@@ -110,7 +132,53 @@ namespace spine {
 
 		Vector<Timeline *> &getTimelines();
 
-		bool hasTimeline(Vector<PropertyId> ids);
+		/// The TimelineKind of each timeline, determined when the animation is created so AnimationState can dispatch
+		/// on it without calling Timeline::getRTTI().
+		Vector<unsigned char> &getTimelineKinds();
+
+		bool hasTimeline(Vector<PropertyId> &ids);
+
+		/// Resamples the bone timelines at a fixed rate into one buffer, from which AnimationState samples all their
+		/// values at once with a lerp of two frames instead of evaluating each curve. Timelines whose curves the lerp
+		/// misses by more than maxError, in the units of their values, are left to their curves. Animation::apply()
+		/// always uses the curves. Replaces a previous bake. Must not be called while the animation is applied.
+		/// @return The baked animation, owned by this animation.
+		BakedAnimation *bake(float fps, float maxError);
+
+		/// Discards the baked animation, the timelines use their curves again.
+		void unbake();
+
+		/// The animation baked by bake(), or NULL.
+		BakedAnimation *getBaked();
+
+		/// Groups the bone timelines by type so Animation::apply() and AnimationState apply each group with one kernel
+		/// instead of a virtual call per timeline, see BatchedTimelines. AnimationState uses the groups for track
+		/// entries applied with a single blend, ie the first track at full alpha and MixBlend_Add tracks, and applies
+		/// the timelines one by one otherwise. Replaces a previous grouping. Must be called again after timelines are
+		/// added, removed or change their bone, and not while the animation is applied.
+		/// @return The groups, owned by this animation.
+		BatchedTimelines *batch();
+
+		/// Discards the groups, the timelines are applied one by one again.
+		void unbatch();
+
+		/// The groups made by batch(), or NULL.
+		BatchedTimelines *getBatched();
+
+		/// Compresses the keys of the timelines that have one or two values per key, see CurveTimeline::compress().
+		/// Timelines compressed before are skipped. Color, deform and the other timelines keep their keys.
+		/// @param bits 8 or 16 bits per value.
+		/// @param tolerance The difference from a key at which it is kept, in the units of the values.
+		/// @return The largest sampled difference from the uncompressed values of any timeline compressed so far, a
+		/// lower bound, see CurveTimeline::compress().
+		float compress(int bits, float tolerance);
+
+		/// The largest difference from the uncompressed values sampled at the keys, the eighths between them and the
+		/// bezier points, or 0 if not compressed. A lower bound, the difference between the samples can be larger.
+		float getCompressionError();
+
+		/// The bytes allocated for the keys and curves of all timelines.
+		size_t getMemorySize();
 
 		float getDuration();
 
@@ -120,11 +188,37 @@ namespace spine {
 		static int search(Vector<float> &values, float target);
 
 		static int search(Vector<float> &values, float target, int step);
+
+		/// Sets the frame cursor used by searches on the calling thread, or NULL for none. A cursor holds the frame found
+		/// by the previous search of the same timeline, which during playback is nearly always the frame searched for or the
+		/// one before it, making a search O(1). Other targets, e.g. after seeking or looping, fall back to a binary search.
+		/// AnimationState sets a cursor per track entry and timeline before applying each timeline.
+		static void setSearchCursor(int *cursor);
+
+		/// Sets the values sampled from the baked animation that the curve timelines return on the calling thread, or
+		/// NULL for none. AnimationState sets them per track entry before applying the entry's timelines.
+		static void setBakedValues(const float *values);
+
+		static const float *getBakedValues();
+
 	private:
 		Vector<Timeline *> _timelines;
+		Vector<unsigned char> _timelineKinds;
 		HashMap<PropertyId, bool> _timelineIds;
+		SkeletonData *_propertyIndexOwner;
+		Vector<uint32_t> _propertyBits;
 		float _duration;
 		String _name;
+		BakedAnimation *_baked;
+		BatchedTimelines *_batched;
+		float _compressionError;
+
+		/// Builds the bitset of keyed property indices. See SkeletonData::indexProperties().
+		void indexProperties(SkeletonData *owner, int propertyCount);
+
+		/// Returns true if the animation has a timeline for any of the property indices. Only valid for property indices
+		/// assigned by the same SkeletonData as this animation's.
+		bool hasProperty(Vector<int> &propertyIndices);
 	};
 }
 
@@ -39,6 +39,8 @@
 #include <spine/HasRendererObject.h>
 #include "Slot.h"
 
+#include <stdint.h>
+
 #ifdef SPINE_USE_STD_FUNCTION
 #include <functional>
 #endif
@@ -69,6 +71,12 @@ namespace spine {
 
 	class AttachmentTimeline;
 
+	class Timeline;
+
+	class SkeletonData;
+
+	class PoseCache;
+
 #ifdef SPINE_USE_STD_FUNCTION
 	typedef std::function<void (AnimationState* state, EventType type, TrackEntry* entry, Event* event)> AnimationStateListener;
 #else
@@ -288,6 +296,8 @@ namespace spine {
 		Vector<int> _timelineMode;
 		Vector<TrackEntry *> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
+		Vector<int> _timelinesCursor;
+		Vector<float> _bakedValues;
 		AnimationStateListener _listener;
 		AnimationStateListenerObject *_listenerObject;
 
@@ -356,6 +366,15 @@ namespace spine {
 		/// animation state can be applied to multiple skeletons to pose them identically.
 		bool apply(Skeleton &skeleton);
 
+		/// Fires the events apply() would fire without posing the skeleton, for frames on which the skeleton is not
+		/// evaluated, see SkeletonInterpolator. The next apply() only fires the events after this time.
+		/// @return True if any animations were applied.
+		bool applyEvents(Skeleton &skeleton);
+
+		/// Returns true if the next apply() may not be replaced by applyEvents() because it makes a change that later
+		/// applications do not repeat: animations were started or ended, a mix completes or a track ends.
+		bool isApplyRequired();
+
 		/// Removes all animations from all tracks, leaving skeletons in their previous pose.
 		/// It may be desired to use AnimationState.setEmptyAnimations(float) to mix the skeletons back to the setup pose,
 		/// rather than leaving them in their previous pose.
@@ -421,6 +440,24 @@ namespace spine {
 
 		void setTimeScale(float inValue);
 
+		/// Tracks other than the first are not applied while their alpha, multiplied by the mix of the entries they mix
+		/// from, is less than this, eg to skip layered animations that barely show on skeletons drawn small, see
+		/// SkeletonLod. Their events are still fired. Default is 0.
+		float getMinTrackAlpha();
+
+		void setMinTrackAlpha(float inValue);
+
+		/// When false, deform timelines are not applied and meshes keep their current deform. Default is true.
+		bool isDeformTimelinesEnabled();
+
+		void setDeformTimelinesEnabled(bool inValue);
+
+		/// The cache from which the bone poses of the first track are copied while its entry is applied fully, or NULL.
+		/// The cache can be shared by the AnimationStates of skeletons of the same SkeletonData. Default is NULL.
+		PoseCache *getPoseCache();
+
+		void setPoseCache(PoseCache *inValue);
+
 		void setListener(AnimationStateListener listener);
 
 		void setListener(AnimationStateListenerObject *listener);
@@ -429,6 +466,10 @@ namespace spine {
 
 		void enableQueue();
 
+		/// Calls the listeners for the queued events, eg those queued while the queue was disabled so update() and
+		/// apply() could run on another thread.
+		void drainQueue();
+
 	private:
 		static const int Subsequent = 0;
 		static const int First = 1;
@@ -447,6 +488,8 @@ namespace spine {
 		EventQueue *_queue;
 
 		HashMap<PropertyId, bool> _propertyIDs;
+		SkeletonData *_propertyIndexOwner;
+		Vector<uint32_t> _propertyBits;
 		bool _animationsChanged;
 
 		AnimationStateListener _listener;
@@ -456,6 +499,12 @@ namespace spine {
 
 		float _timeScale;
 
+		float _minTrackAlpha;
+
+		bool _deformTimelines;
+
+		PoseCache *_poseCache;
+
 		static Animation *getEmptyAnimation();
 
 		static void
@@ -470,6 +519,15 @@ namespace spine {
 
 		float applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBlend currentPose);
 
+		/// Fires the events of the entries the entry mixes from, as applyMixingFrom() does.
+		void applyMixingFromEvents(TrackEntry *to, Skeleton &skeleton);
+
+		/// Applies only the event timelines of the entry's animation.
+		void applyEventTimelines(TrackEntry &entry, Skeleton &skeleton, float applyTime, Vector<Event *> *events);
+
+		/// Samples the entry's baked animation, if any, for the entry's timelines applied next. See Animation::bake().
+		void sampleBakedValues(TrackEntry &entry, float applyTime);
+
 		void queueEvents(TrackEntry *entry, float animationTime);
 
 		/// Sets the active TrackEntry for a given track number.
@@ -488,6 +546,12 @@ namespace spine {
 
 		void computeHold(TrackEntry *entry);
 
+		/// Marks the properties of the timeline as keyed, returns true if any of them was not keyed yet.
+		bool addProperties(Timeline *timeline);
+
+		/// Returns true if the animation has a timeline for any of the properties of the timeline.
+		bool hasProperties(Animation *animation, Timeline *timeline);
+
 		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, bool attachments);
 	};
 }
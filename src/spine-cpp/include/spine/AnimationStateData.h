@@ -63,6 +63,15 @@ namespace spine {
 		/// See TrackEntry.MixDuration.
 		void setMix(Animation *from, Animation *to, float duration);
 
+		/// Sets the mix durations between all pairs of the specified animations. The durations are a row major matrix of
+		/// animations.size() * animations.size() entries, the entry at from * animations.size() + to is the duration used when
+		/// changing from the from animation to the to animation. Negative entries are skipped and keep using the DefaultMix.
+		void setMixes(Vector<Animation *> &animations, Vector<float> &durations);
+
+		/// Sets the mix durations between all pairs of the animations with the specified names, which must all exist.
+		/// See setMixes(Vector<Animation *> &, Vector<float> &).
+		void setMixes(Vector<String> &animationNames, Vector<float> &durations);
+
 		/// The mix duration to use when changing from the specified animation to the other,
 		/// or the DefaultMix if no mix duration has been set.
 		float getMix(Animation *from, Animation *to);
@@ -79,6 +88,8 @@ namespace spine {
 			explicit AnimationPair(Animation *a1 = NULL, Animation *a2 = NULL);
 
 			bool operator==(const AnimationPair &other) const;
+
+			size_t hashCode() const;
 		};
 
 		SkeletonData *_skeletonData;
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BakedAnimation_h
+#define Spine_BakedAnimation_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+#include <stddef.h>
+
+namespace spine {
+	class Animation;
+
+	class CurveTimeline;
+
+	/// The bone timelines of an animation resampled at a fixed rate, see Animation::bake(). The values of all baked
+	/// timelines at one time form a row of channels, one channel per value of a timeline, and the rows are stored one
+	/// after another, so sampling a time reads two adjacent rows and lerps between them.
+	class SP_API BakedAnimation : public SpineObject {
+	public:
+		BakedAnimation(Animation &animation, float fps, float maxError);
+
+		~BakedAnimation();
+
+		/// Lerps the values of all channels at the time between the two frames around it. The lerp is computed 8 or 4
+		/// channels at a time with AVX, SSE or NEON when available.
+		/// @param values At least getStride() entries.
+		void sample(float time, float *values);
+
+		Animation &getAnimation();
+
+		float getFps();
+
+		/// The number of baked channels.
+		size_t getChannelCount();
+
+		/// The number of floats per frame, the channel count rounded up to a multiple of 8.
+		size_t getStride();
+
+		size_t getFrameCount();
+
+		/// The number of timelines that were baked. The other bone timelines missed the error limit and use their curves.
+		size_t getTimelineCount();
+
+		/// The largest difference between the lerped and the curve values of any baked channel, measured between the
+		/// frames when baking.
+		float getMaxError();
+
+		/// The largest difference between the lerped and the curve values of the channel.
+		float getMaxError(size_t channel);
+
+		/// The bytes allocated for the frames.
+		size_t getMemorySize();
+
+		/// The bytes allocated for the keys and curves of the baked timelines, which they keep for Animation::apply().
+		size_t getCurveMemorySize();
+
+	private:
+		Animation &_animation;
+		float _fps;
+		size_t _channelCount;
+		size_t _stride;
+		size_t _frameCount;
+		float *_frames;
+		Vector<float> _errors;
+		Vector<CurveTimeline *> _timelines;
+	};
+}
+
+#endif /* Spine_BakedAnimation_h */
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BatchedTimelines_h
+#define Spine_BatchedTimelines_h
+
+#include <spine/MixBlend.h>
+#include <spine/MixDirection.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+#include <stddef.h>
+
+namespace spine {
+	class Animation;
+
+	class Bone;
+
+	class CurveTimeline;
+
+	class Skeleton;
+
+	class SkeletonPose;
+
+	/// The bone timelines of an animation grouped by type, see Animation::batch(). Each group is applied by one kernel
+	/// that first evaluates the curves of all its timelines and then blends the values into the bone pose arrays of
+	/// SkeletonPose, with the MixBlend switch and the bone lookups hoisted out of the blend loops. The values of baked
+	/// timelines are read from the values AnimationState sampled, see Animation::setBakedValues(). Timelines that key a
+	/// property another timeline of the animation also keys are left ungrouped, so the order they are applied in stays
+	/// the same.
+	class SP_API BatchedTimelines : public SpineObject {
+	public:
+		explicit BatchedTimelines(Animation &animation);
+
+		~BatchedTimelines();
+
+		/// Applies the grouped timelines like Timeline::apply().
+		/// @param cursors One search cursor per timeline of the animation, set for each timeline before its curve is
+		/// evaluated, or NULL to leave the current cursor. See Animation::setSearchCursor().
+		/// @param skip One entry per timeline of the animation, true for the timelines not to apply, or NULL.
+		void apply(Skeleton &skeleton, float time, float alpha, MixBlend blend, MixDirection direction, int *cursors,
+				   const bool *skip);
+
+		Animation &getAnimation();
+
+		/// One entry per timeline of the animation, true for the timelines applied by apply().
+		Vector<bool> &getGrouped();
+
+		/// The number of grouped timelines.
+		size_t getTimelineCount();
+
+	private:
+		enum Group {
+			Group_Rotate = 0,
+			Group_TranslateX,
+			Group_TranslateY,
+			Group_Translate,
+			Group_ScaleX,
+			Group_ScaleY,
+			Group_Scale,
+			Group_ShearX,
+			Group_ShearY,
+			Group_Shear,
+			Group_Count
+		};
+
+		Animation &_animation;
+		// The timelines of each group, from _groupOffsets[group] to _groupOffsets[group + 1], with their bone indices
+		// and their indices in the animation.
+		Vector<CurveTimeline *> _timelines;
+		Vector<int> _bones;
+		Vector<int> _indices;
+		size_t _groupOffsets[Group_Count + 1];
+		Vector<bool> _grouped;
+
+		void applyGroup(SkeletonPose &pose, Bone **bones, Group group, float time, float alpha, MixBlend blend,
+						MixDirection direction, int *cursors, const bool *skip, const float *baked);
+	};
+}
+
+#endif /* Spine_BatchedTimelines_h */
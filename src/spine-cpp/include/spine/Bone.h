@@ -32,6 +32,7 @@
 
 #include <spine/Updatable.h>
 #include <spine/SpineObject.h>
+#include <spine/SkeletonPose.h>
 #include <spine/Vector.h>
 
 namespace spine {
@@ -44,9 +45,13 @@ namespace spine {
 /// A bone has a local transform which is used to compute its world transform. A bone also has an applied transform, which is a
 /// local transform that can be applied to compute the world transform. The local transform and applied transform may differ if a
 /// constraint or application code modifies the world transform after it was computed from the local transform.
+///
+/// The transforms are stored in the skeleton's SkeletonPose, a bone is a view of its entries there.
 	class SP_API Bone : public Updatable {
 		friend class AnimationState;
 
+		friend class BatchedTimelines;
+
 		friend class RotateTimeline;
 
 		friend class IkConstraint;
@@ -254,13 +259,37 @@ namespace spine {
 		Skeleton &_skeleton;
 		Bone *_parent;
 		Vector<Bone *> _children;
-		float _x, _y, _rotation, _scaleX, _scaleY, _shearX, _shearY;
-		float _ax, _ay, _arotation, _ascaleX, _ascaleY, _ashearX, _ashearY;
-		float _a, _b, _worldX;
-		float _c, _d, _worldY;
+		SkeletonPose &_pose;
+		int _index;
 		bool _sorted;
 		bool _active;
 
+		inline float &pose(PoseComponent component) {
+			return _pose.getComponent(component)[_index];
+		}
+
+		// The bone's entries in the skeleton's SkeletonPose.
+		inline float &_x() { return pose(PoseComponent_X); }
+		inline float &_y() { return pose(PoseComponent_Y); }
+		inline float &_rotation() { return pose(PoseComponent_Rotation); }
+		inline float &_scaleX() { return pose(PoseComponent_ScaleX); }
+		inline float &_scaleY() { return pose(PoseComponent_ScaleY); }
+		inline float &_shearX() { return pose(PoseComponent_ShearX); }
+		inline float &_shearY() { return pose(PoseComponent_ShearY); }
+		inline float &_ax() { return pose(PoseComponent_AX); }
+		inline float &_ay() { return pose(PoseComponent_AY); }
+		inline float &_arotation() { return pose(PoseComponent_ARotation); }
+		inline float &_ascaleX() { return pose(PoseComponent_AScaleX); }
+		inline float &_ascaleY() { return pose(PoseComponent_AScaleY); }
+		inline float &_ashearX() { return pose(PoseComponent_AShearX); }
+		inline float &_ashearY() { return pose(PoseComponent_AShearY); }
+		inline float &_a() { return pose(PoseComponent_A); }
+		inline float &_b() { return pose(PoseComponent_B); }
+		inline float &_c() { return pose(PoseComponent_C); }
+		inline float &_d() { return pose(PoseComponent_D); }
+		inline float &_worldX() { return pose(PoseComponent_WorldX); }
+		inline float &_worldY() { return pose(PoseComponent_WorldY); }
+
 		/// Computes the individual applied transform values from the world transform. This can be useful to perform processing using
 		/// the applied transform after the world transform has been modified directly (eg, by a constraint)..
 		///
@@ -48,6 +48,8 @@ namespace spine {
 	public:
 		explicit ClippingAttachment(const String &name);
 
+		virtual ~ClippingAttachment();
+
 		SlotData *getEndSlot();
 
 		void setEndSlot(SlotData *inValue);
@@ -56,9 +58,18 @@ namespace spine {
 
 		virtual Attachment *copy();
 
+		/// Triangulates and decomposes the clipping polygon into convex polygons in local space. The loaders call
+		/// this, call it again after changing the vertices of an attachment. Weighted attachments have no cached
+		/// decomposition, as their shape changes with the bones.
+		void updateConvexPolygons();
+
+		/// The clockwise convex polygons of the unweighted clipping polygon in local space, empty if weighted.
+		Vector<Vector<float> *> &getConvexPolygons();
+
 	private:
 		SlotData *_endSlot;
 		Color _color;
+		Vector<Vector<float> *> _convexPolygons;
 	};
 }
 
@@ -38,6 +38,10 @@ namespace spine {
 	class SP_API CurveTimeline : public Timeline {
 	RTTI_DECL
 
+		friend class BakedAnimation;
+
+		friend class BatchedTimelines;
+
 	public:
 		explicit CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount);
 
@@ -55,6 +59,20 @@ namespace spine {
 
 		Vector<float> &getCurves();
 
+		/// Quantizes the values of the keys and bezier curves to 8 or 16 bits, relative to the range of each value,
+		/// and removes linear and stepped keys that the keys around them reproduce within the tolerance. A value whose
+		/// range is within the tolerance is stored once, and a timeline whose values are all constant keeps only its
+		/// first key. The values are decompressed when the timeline is applied. Afterward the frames hold only the key
+		/// times and the curves only the key curve types, and the keys must not be set again. Only for CurveTimeline1
+		/// and CurveTimeline2.
+		/// @return The largest difference from the uncompressed values sampled at the keys, at the eighths between them
+		/// and at the bezier points. This is a lower bound, the difference between the samples can be larger.
+		float compress(int bits, float tolerance);
+
+		bool isCompressed();
+
+		virtual size_t getMemorySize();
+
 	protected:
 		static const int LINEAR = 0;
 		static const int STEPPED = 1;
@@ -62,6 +80,33 @@ namespace spine {
 		static const int BEZIER_SIZE = 18;
 
 		Vector<float> _curves; // type, x, y, ...
+		// The first channel of the values sampled from the animation's BakedAnimation, or -1 if not baked.
+		int _bakedChannel;
+		// The keys and bezier curves quantized by compress(), 0 bits if not compressed. A value is decompressed as
+		// offset + q * scale. Each key stores q for the values with a scale, stride entries per key, followed by the
+		// bezier curves in the layout of _curves, with x as a fraction of the time between the keys, which bezier
+		// curves with steep handles exceed. An entry is 1 or 2 bytes.
+		int _quantizedBits;
+		size_t _quantizedStride;
+		Vector<float> _quantizedOffsets, _quantizedScales;
+		float _quantizedCurveOffset, _quantizedCurveScale;
+		Vector<unsigned char> _quantized;
+
+		/// Decompresses all values at the time.
+		void getQuantizedValues(float time, float *values);
+
+	private:
+		/// Returns the value of the uncompressed keys at the time, for value 1 to frame entries - 1.
+		float getKeyValue(float time, size_t value);
+
+		/// Whether the key is reproduced within the tolerance by the kept key before it and the key after it.
+		bool isRedundant(size_t previous, size_t frame, float tolerance);
+
+		int getQuantized(size_t i);
+
+		float getQuantizedKey(size_t frame, size_t value);
+
+		float getQuantizedBezierValue(float time, size_t frame, size_t value, size_t i);
 	};
 
 	class SP_API CurveTimeline1 : public CurveTimeline {
@@ -74,6 +119,8 @@ namespace spine {
 
 		void setFrame(size_t frame, float time, float value);
 
+		/// Returns the value at the time. While AnimationState applies a baked animation, the value is taken from the
+		/// values it sampled for the time, see Animation::bake(). Compressed keys are decompressed, see compress().
 		float getCurveValue(float time);
 
 	protected:
@@ -93,6 +140,9 @@ namespace spine {
 
 		float getCurveValue(float time);
 
+		/// Returns both values at the time, taken from the baked values like CurveTimeline1::getCurveValue().
+		void getCurveValues(float time, float &value1, float &value2);
+
 	protected:
 		static const int ENTRIES = 3;
 		static const int VALUE1 = 1;
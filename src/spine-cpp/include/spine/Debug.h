@@ -36,7 +36,8 @@
 #include <map>
 
 namespace spine {
-
+	/// Wraps an extension to track allocations and report leaks. Not thread-safe, so it must not be installed while
+	/// skeletons are updated on several threads.
 	class SP_API DebugExtension : public SpineExtension {
 		struct Allocation {
 			void *address;
@@ -54,6 +54,8 @@ namespace spine {
 
 		Vector <Vector<float>> &getVertices();
 
+		virtual size_t getMemorySize();
+
 		VertexAttachment *getAttachment();
 
 		void setAttachment(VertexAttachment *inValue);
@@ -42,6 +42,48 @@
 #endif
 
 namespace spine {
+	/// Hashes the keys of a HashMap. Integer and pointer keys are supported out of the box, other key types
+	/// provide a size_t hashCode() const method that is consistent with their operator==.
+	template<typename K>
+	struct HashCode {
+		static size_t hash(const K &key) {
+			return key.hashCode();
+		}
+	};
+
+	/// Scrambles the bits of an integer so consecutive keys spread over the whole table.
+	inline size_t hashMix(unsigned long long h) {
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ULL;
+		h ^= h >> 33;
+		return (size_t) h;
+	}
+
+	template<>
+	struct HashCode<int> {
+		static size_t hash(int key) { return hashMix((unsigned long long) key); }
+	};
+
+	template<>
+	struct HashCode<long long> {
+		static size_t hash(long long key) { return hashMix((unsigned long long) key); }
+	};
+
+	template<>
+	struct HashCode<size_t> {
+		static size_t hash(size_t key) { return hashMix((unsigned long long) key); }
+	};
+
+	template<typename T>
+	struct HashCode<T *> {
+		static size_t hash(T *key) { return hashMix((unsigned long long) (size_t) key); }
+	};
+
+	/// Hash map with open addressing and linear probing. Entries are stored in a single contiguous array whose capacity is
+	/// a power of two, it grows when more than 70% of it is used. Removal shifts the following entries back instead of
+	/// leaving tombstones, so lookups never get slower as entries come and go.
 	template<typename K, typename V>
 	class SP_API HashMap : public SpineObject {
 	private:
@@ -60,47 +102,45 @@ namespace spine {
 		public:
 			friend class HashMap;
 
-			explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-				_start.next = entry;
-				_entry = &_start;
+			explicit Entries(Entry *entries, size_t capacity) : _hasChecked(false), _entries(entries),
+																_capacity(capacity), _index(0), _next(0) {
 			}
 
 			Pair next() {
-				assert(_entry);
 				assert(_hasChecked);
-				_entry = _entry->next;
-				Pair pair(_entry->_key, _entry->_value);
+				assert(_next < _capacity);
+				_index = _next + 1;
+				Entry &entry = _entries[_next];
+				Pair pair(entry._key, entry._value);
 				_hasChecked = false;
 				return pair;
 			}
 
 			bool hasNext() {
 				_hasChecked = true;
-				return _entry->next;
+				for (_next = _index; _next < _capacity; _next++)
+					if (_entries[_next]._used) return true;
+				return false;
 			}
 
 		private:
 			bool _hasChecked;
-			Entry _start;
-			Entry *_entry;
+			Entry *_entries;
+			size_t _capacity;
+			size_t _index;
+			size_t _next;
 		};
 
 		HashMap() :
-				_head(NULL),
 				_size(0) {
 		}
 
 		~HashMap() {
-			clear();
 		}
 
 		void clear() {
-			for (Entry *entry = _head; entry != NULL;) {
-				Entry *next = entry->next;
-				delete entry;
-				entry = next;
-			}
-			_head = NULL;
+			for (size_t i = 0, n = _entries.size(); i < n; ++i)
+				_entries[i] = Entry();
 			_size = 0;
 		}
 
@@ -113,22 +153,19 @@ namespace spine {
 			if (entry) {
 				entry->_key = key;
 				entry->_value = value;
-			} else {
-				entry = new(__FILE__, __LINE__) Entry();
-				entry->_key = key;
-				entry->_value = value;
-
-				Entry *oldHead = _head;
-
-				if (oldHead) {
-					_head = entry;
-					oldHead->prev = entry;
-					entry->next = oldHead;
-				} else {
-					_head = entry;
-				}
-				_size++;
+				return;
 			}
+
+			if ((_size + 1) * 10 > _entries.size() * 7) grow();
+			size_t mask = _entries.size() - 1;
+			size_t i = HashCode<K>::hash(key) & mask;
+			while (_entries[i]._used)
+				i = (i + 1) & mask;
+			entry = &_entries[i];
+			entry->_key = key;
+			entry->_value = value;
+			entry->_used = true;
+			_size++;
 		}
 
 		bool addAll(Vector <K> &keys, const V &value) {
@@ -147,19 +184,33 @@ namespace spine {
 			Entry *entry = find(key);
 			if (!entry) return false;
 
-			Entry *prev = entry->prev;
-			Entry *next = entry->next;
-
-			if (prev) prev->next = next;
-			else _head = next;
-			if (next) next->prev = entry->prev;
-
-			delete entry;
+			// Shift back entries of the probe sequence that would otherwise become unreachable
+			size_t mask = _entries.size() - 1;
+			size_t hole = entry - _entries.buffer();
+			for (size_t i = (hole + 1) & mask; _entries[i]._used; i = (i + 1) & mask) {
+				size_t home = HashCode<K>::hash(_entries[i]._key) & mask;
+				if (((i - home) & mask) >= ((i - hole) & mask)) {
+					_entries[hole] = _entries[i];
+					hole = i;
+				}
+			}
+			_entries[hole] = Entry();
 			_size--;
 
 			return true;
 		}
 
+		/// Returns the value for the key, or the default value if the key is not in the map.
+		V get(const K &key, const V &defaultValue) {
+			Entry *entry = find(key);
+			return entry ? entry->_value : defaultValue;
+		}
+
+		/// Grows the table so the specified number of entries can be put without rehashing.
+		void ensureCapacity(size_t size) {
+			while (size * 10 > _entries.size() * 7) grow();
+		}
+
 		V operator[](const K &key) {
 			Entry *entry = find(key);
 			if (entry) return entry->_value;
@@ -170,29 +221,41 @@ namespace spine {
 		}
 
 		Entries getEntries() const {
-			return Entries(_head);
+			HashMap *self = const_cast<HashMap *>(this);
+			return Entries(self->_entries.buffer(), self->_entries.size());
 		}
 
 	private:
 		Entry *find(const K &key) {
-			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-				if (entry->_key == key)
-					return entry;
+			if (_size == 0) return NULL;
+			size_t mask = _entries.size() - 1;
+			for (size_t i = HashCode<K>::hash(key) & mask; _entries[i]._used; i = (i + 1) & mask) {
+				if (_entries[i]._key == key)
+					return &_entries[i];
 			}
 			return NULL;
 		}
 
-		class SP_API Entry : public SpineObject {
+		void grow() {
+			size_t capacity = _entries.size() < 8 ? 16 : _entries.size() << 1;
+			Vector<Entry> old(_entries);
+			_entries.clear();
+			_entries.setSize(capacity, Entry());
+			_size = 0;
+			for (size_t i = 0, n = old.size(); i < n; ++i)
+				if (old[i]._used) put(old[i]._key, old[i]._value);
+		}
+
+		class SP_API Entry {
 		public:
 			K _key;
 			V _value;
-			Entry *next;
-			Entry *prev;
+			bool _used;
 
-			Entry() : next(NULL), prev(NULL) {}
+			Entry() : _key(), _value(), _used(false) {}
 		};
 
-		Entry *_head;
+		Vector<Entry> _entries;
 		size_t _size;
 	};
 }
@@ -58,18 +58,34 @@ namespace spine {
 
 		static float abs(float v);
 
-		/// Returns the sine in radians from a lookup table.
+		/// Returns the sine in radians. See setFastTrig().
 		static float sin(float radians);
 
-		/// Returns the cosine in radians from a lookup table.
+		/// Returns the cosine in radians. See setFastTrig().
 		static float cos(float radians);
 
-		/// Returns the sine in radians from a lookup table.
+		/// Returns the sine in degrees. See setFastTrig().
 		static float sinDeg(float degrees);
 
-		/// Returns the cosine in radians from a lookup table.
+		/// Returns the cosine in degrees. See setFastTrig().
 		static float cosDeg(float degrees);
 
+		/// Returns both the sine and the cosine in degrees, sharing the range reduction in fast mode.
+		static void sinCosDeg(float degrees, float &sine, float &cosine);
+
+		/// Computes the sines and cosines in degrees of count angles. In fast mode 8 or 4 angles are computed at a time
+		/// with AVX, SSE or NEON when available.
+		static void sinCosDeg(const float *degrees, float *sines, float *cosines, size_t count);
+
+		/// When true, sin, cos, sinDeg, cosDeg and sinCosDeg use a polynomial approximation instead of the C library. The
+		/// angle is reduced to [-45, 45] degrees and evaluated with degree 7 and 8 polynomials. The max absolute error of
+		/// the degree functions is 4e-7, checked by samples/Checks/src/TrigCheck.cpp, sin and cos add the rounding of the
+		/// conversion to degrees. Angles of 2^22 degrees and beyond use the C library. The default is false, or true when
+		/// compiled with SPINE_FAST_TRIG defined.
+		static void setFastTrig(bool fast);
+
+		static bool isFastTrig();
+
 		/// Returns atan2 in radians, faster but less accurate than Math.Atan2. Average error of 0.00231 radians (0.1323
 		/// degrees), largest error of 0.00488 radians (0.2796 degrees).
 		static float atan2(float y, float x);
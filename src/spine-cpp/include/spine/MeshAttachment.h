@@ -71,6 +71,11 @@ namespace spine {
 
 		Vector<unsigned short> &getTriangles();
 
+		/// The triangles of the hull polygon, see getHullLength(), which index only the hull vertices. Computed from the
+		/// region UVs by the first call and kept until setHullLength() is called, so the first call for an attachment
+		/// must not run on several threads at once. Empty if the hull has fewer than 3 vertices.
+		Vector<unsigned short> &getHullTriangles();
+
 		Color &getColor();
 
 		const String &getPath();
@@ -109,6 +114,7 @@ namespace spine {
 		Vector<float> _uvs;
 		Vector<float> _regionUVs;
 		Vector<unsigned short> _triangles;
+		Vector<unsigned short> _hullTriangles;
 		Vector<unsigned short> _edges;
 		String _path;
 		Color _color;
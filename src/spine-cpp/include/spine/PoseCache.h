@@ -0,0 +1,150 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_PoseCache_h
+#define Spine_PoseCache_h
+
+#include <spine/HashMap.h>
+#include <spine/MixBlend.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+#ifdef SPINE_THREAD_SAFE_POSE_CACHE
+#include <mutex>
+#endif
+
+namespace spine {
+	class Animation;
+
+	class Skeleton;
+
+	/// Shares the local bone poses that the bone timelines of an animation produce at a time between the skeletons of
+	/// one SkeletonData, eg a crowd playing the same animation in lockstep or on phases quantized to the cache's rate.
+	/// An AnimationState with a cache, see AnimationState::setPoseCache(), copies the cached pose of a fully applied
+	/// first track entry instead of applying its bone timelines, and applies the other timelines as usual. Times are
+	/// quantized to the rate, so the bones move in steps of 1 / rate seconds. Poses are evicted least recently used
+	/// first when they exceed the memory limit.
+	///
+	/// A cache is not thread-safe: AnimationStates that share it must be applied on one thread at a time, or the caller
+	/// must lock around them. When compiled with SPINE_THREAD_SAFE_POSE_CACHE defined, the cache locks a std::mutex
+	/// itself and AnimationStates on several threads can share it.
+	class SP_API PoseCache : public SpineObject {
+	public:
+		/// @param rate The number of poses per second of animation.
+		/// @param maxMemory The limit for the bytes of the cached poses.
+		PoseCache(float rate, size_t maxMemory);
+
+		~PoseCache();
+
+		/// Sets the pose of the animation's bone timelines at the time quantized to the rate, with alpha 1. The pose is
+		/// copied from the cache or, on a miss, applied and cached. A pose is not cached while one of its bones is
+		/// inactive in the skeleton.
+		/// @return One entry per timeline of the animation, true for the bone timelines whose pose was set.
+		const bool *apply(Animation &animation, Skeleton &skeleton, float time, MixBlend blend);
+
+		/// Evicts all poses.
+		void clear();
+
+		float getRate();
+
+		size_t getMaxMemory();
+
+		/// Evicts poses until the rest fit.
+		void setMaxMemory(size_t maxMemory);
+
+		/// The bytes of the cached poses.
+		size_t getMemorySize();
+
+		size_t getPoseCount();
+
+		/// The number of calls to apply() that copied a cached pose.
+		size_t getHits();
+
+		/// The number of calls to apply() that applied the bone timelines.
+		size_t getMisses();
+
+		/// The number of poses evicted to stay within the memory limit.
+		size_t getEvictions();
+
+		void resetStatistics();
+
+	private:
+		class PoseKey : public SpineObject {
+		public:
+			Animation *_animation;
+			int _frame;
+			MixBlend _blend;
+
+			explicit PoseKey(Animation *animation = NULL, int frame = 0, MixBlend blend = MixBlend_Setup);
+
+			bool operator==(const PoseKey &other) const;
+
+			size_t hashCode() const;
+		};
+
+		/// The bone timelines of an animation and the bone pose components they key.
+		class Layout : public SpineObject {
+		public:
+			Vector<bool> _timelines;
+			Vector<int> _bones;
+			Vector<int> _components;
+		};
+
+		/// A cached pose, in the order of its layout's components, linked from most to least recently used.
+		class Pose : public SpineObject {
+		public:
+			PoseKey _key;
+			Vector<float> _values;
+			Pose *_previous;
+			Pose *_next;
+		};
+
+		float _rate;
+		size_t _maxMemory;
+		size_t _memorySize;
+		size_t _hits, _misses, _evictions;
+		HashMap<Animation *, Layout *> _layouts;
+		HashMap<PoseKey, Pose *> _poses;
+		Pose *_first;
+		Pose *_last;
+#ifdef SPINE_THREAD_SAFE_POSE_CACHE
+		std::mutex _mutex;
+#endif
+
+		Layout *getLayout(Animation &animation);
+
+		size_t getSize(Pose *pose);
+
+		void unlink(Pose *pose);
+
+		void evict(size_t maxMemory);
+	};
+}
+
+#endif /* Spine_PoseCache_h */
@@ -0,0 +1,85 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SimdUtil_h
+#define Spine_SimdUtil_h
+
+// Minimal float vector operations for the batched kernels. SPINE_SIMD_WIDTH is defined to the number of lanes when
+// AVX, SSE2 or NEON is available, unless SPINE_NO_SIMD is defined. Masks come from the comparisons and are used with
+// simdSelect and simdNegateIf.
+#if !defined(SPINE_NO_SIMD)
+#if defined(__AVX__)
+#include <immintrin.h>
+#define SPINE_SIMD_WIDTH 8
+typedef __m256 SimdFloat;
+typedef __m256 SimdMask;
+#define simdLoad(p) _mm256_loadu_ps(p)
+#define simdStore(p, v) _mm256_storeu_ps(p, v)
+#define simdSet(f) _mm256_set1_ps(f)
+#define simdAdd(a, b) _mm256_add_ps(a, b)
+#define simdSub(a, b) _mm256_sub_ps(a, b)
+#define simdMul(a, b) _mm256_mul_ps(a, b)
+#define simdEqual(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define simdOr(a, b) _mm256_or_ps(a, b)
+#define simdSelect(mask, a, b) _mm256_or_ps(_mm256_and_ps(mask, a), _mm256_andnot_ps(mask, b))
+#define simdNegateIf(mask, v) _mm256_xor_ps(v, _mm256_and_ps(mask, _mm256_set1_ps(-0.0f)))
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SPINE_SIMD_WIDTH 4
+typedef __m128 SimdFloat;
+typedef __m128 SimdMask;
+#define simdLoad(p) _mm_loadu_ps(p)
+#define simdStore(p, v) _mm_storeu_ps(p, v)
+#define simdSet(f) _mm_set1_ps(f)
+#define simdAdd(a, b) _mm_add_ps(a, b)
+#define simdSub(a, b) _mm_sub_ps(a, b)
+#define simdMul(a, b) _mm_mul_ps(a, b)
+#define simdEqual(a, b) _mm_cmpeq_ps(a, b)
+#define simdOr(a, b) _mm_or_ps(a, b)
+#define simdSelect(mask, a, b) _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b))
+#define simdNegateIf(mask, v) _mm_xor_ps(v, _mm_and_ps(mask, _mm_set1_ps(-0.0f)))
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SPINE_SIMD_WIDTH 4
+typedef float32x4_t SimdFloat;
+typedef uint32x4_t SimdMask;
+#define simdLoad(p) vld1q_f32(p)
+#define simdStore(p, v) vst1q_f32(p, v)
+#define simdSet(f) vdupq_n_f32(f)
+#define simdAdd(a, b) vaddq_f32(a, b)
+#define simdSub(a, b) vsubq_f32(a, b)
+#define simdMul(a, b) vmulq_f32(a, b)
+#define simdEqual(a, b) vceqq_f32(a, b)
+#define simdOr(a, b) vorrq_u32(a, b)
+#define simdSelect(mask, a, b) vbslq_f32(mask, a, b)
+#define simdNegateIf(mask, v) vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v), vandq_u32(mask, vdupq_n_u32(0x80000000))))
+#endif
+#endif
+
+#endif /* Spine_SimdUtil_h */
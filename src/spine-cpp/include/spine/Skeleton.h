@@ -35,6 +35,8 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/Color.h>
+#include <spine/SkeletonData.h>
+#include <spine/SkeletonPose.h>
 
 namespace spine {
 	class SkeletonData;
@@ -58,6 +60,8 @@ namespace spine {
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
+		friend class SkeletonData;
+
 		friend class SkeletonBounds;
 
 		friend class SkeletonClipping;
@@ -117,8 +121,17 @@ namespace spine {
 
 		~Skeleton();
 
+		/// Creates a skeleton with the same data and state as this one, see setTo(). Faster than constructing a skeleton
+		/// from the data, because the update cache is copied instead of sorted. The returned skeleton must be deleted.
+		Skeleton *clone();
+
+		/// Sets the skin, update cache, bone poses, slots, draw order, constraint values, color, position and scale to
+		/// those of a skeleton, which must have the same data, reusing this skeleton's allocations.
+		void setTo(Skeleton &skeleton);
+
 		/// Caches information about bones and constraints. Must be called if bones, constraints or weighted path attachments are added
-		/// or removed.
+		/// or removed, or if the transform mode of a bone is changed. The result for each skin of the SkeletonData is prepared by
+		/// the data and adopted by all skeletons using that skin, see SkeletonData::prepareUpdateOrders().
 		void updateCache();
 
 		void printUpdateCache();
@@ -128,6 +141,57 @@ namespace spine {
 
 		void updateWorldTransform(Bone *parent);
 
+		/// When true, updateWorldTransform() only recomputes the bones whose local transform changed since the last update
+		/// and their descendants, the constraints whose bones, target or mix values changed, and the bones those
+		/// constraints affect. Path constraints are always applied. Changes made directly to world or applied transforms
+		/// are not detected. The tracking costs about as much as updating a fifth of the bones, so this pays off for
+		/// skeletons that are idle or animate few bones. Default is false.
+		void setIncrementalUpdate(bool incremental);
+
+		bool isIncrementalUpdate();
+
+		/// When false, updateWorldTransform() does not apply the skeleton's IK constraints, eg to reduce the work for
+		/// skeletons that are drawn small, see SkeletonLod. Default is true.
+		void setIkConstraintsEnabled(bool enabled);
+
+		bool isIkConstraintsEnabled();
+
+		/// When false, updateWorldTransform() does not apply the skeleton's transform constraints. Default is true.
+		void setTransformConstraintsEnabled(bool enabled);
+
+		bool isTransformConstraintsEnabled();
+
+		/// When false, updateWorldTransform() does not apply the skeleton's path constraints. Default is true.
+		void setPathConstraintsEnabled(bool enabled);
+
+		bool isPathConstraintsEnabled();
+
+		/// The number of bone updates the last updateWorldTransform() skipped because their inputs were unchanged.
+		size_t getSkippedBoneCount();
+
+		/// Begins an update of the world transforms that is run group by group with updateGroup() instead of by
+		/// updateWorldTransform(), eg on several threads. Each group must then be updated once, after the groups it
+		/// depends on, followed by endUpdateWorldTransform(). Unlike updateWorldTransform(), the bones are not batched.
+		void beginUpdateWorldTransform();
+
+		/// Updates the bones and constraints of a group in update cache order. Groups that do not depend on each other
+		/// change disjoint bones and may be updated at the same time.
+		void updateGroup(size_t group);
+
+		void endUpdateWorldTransform();
+
+		/// The number of groups the update cache is partitioned into. A group is a chain of bones and constraints where
+		/// each depends only on the one before, eg a limb, merged with small neighbouring groups. Groups are numbered so
+		/// each comes after the groups it depends on. The groups are computed by the first call after updateCache().
+		size_t getUpdateGroupCount();
+
+		/// The number of groups that must be updated before the group.
+		size_t getUpdateGroupDependencyCount(size_t group);
+
+		/// The groups that depend on the group.
+		/// @param count Set to the number of dependents.
+		int *getUpdateGroupDependents(size_t group, size_t &count);
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
@@ -186,6 +250,9 @@ namespace spine {
 
 		Vector<Bone *> &getBones();
 
+		/// The local, applied and world transforms of the bones, indexed by bone index.
+		SkeletonPose &getPose();
+
 		Vector<Updatable *> &getUpdateCacheList();
 
 		Vector<Slot *> &getSlots();
@@ -222,6 +289,9 @@ namespace spine {
 
 	private:
 		SkeletonData *_data;
+		// Holds the bones, slots and constraints.
+		char *_arena;
+		SkeletonPose _pose;
 		Vector<Bone *> _bones;
 		Vector<Slot *> _slots;
 		Vector<Slot *> _drawOrder;
@@ -229,10 +299,88 @@ namespace spine {
 		Vector<TransformConstraint *> _transformConstraints;
 		Vector<PathConstraint *> _pathConstraints;
 		Vector<Updatable *> _updateCache;
+		// Runs of TransformMode_Normal bones in the update cache computed by SkeletonPose::updateLocalTransforms() and
+		// updateWorldTransforms(), as update cache start, update cache end, first level and level count. The bones of a
+		// level share their depth in the hierarchy, each level is an offset and a count in _batchBones and _batchParents.
+		Vector<size_t> _batchRuns;
+		Vector<size_t> _batchLevels;
+		Vector<int> _batchBones;
+		Vector<int> _batchParents;
+		// The update cache entries of each group in _groupEntries, from _groupOffsets[group] to _groupOffsets[group + 1],
+		// and the groups that depend on each group in _groupDependents, delimited by _dependentOffsets. _groupOffsets is
+		// empty until the groups are computed.
+		Vector<size_t> _groupOffsets;
+		Vector<size_t> _groupEntries;
+		Vector<size_t> _dependentOffsets;
+		Vector<int> _groupDependents;
+		Vector<size_t> _groupDependencyCounts;
 		Skin *_skin;
 		Color _color;
 		float _scaleX, _scaleY;
 		float _x, _y;
+		bool _incremental;
+		bool _ikEnabled, _transformEnabled, _pathEnabled;
+		// False when the world transforms were not computed by an incremental update from the tracked state.
+		bool _tracked;
+		size_t _skippedBones;
+		Vector<bool> _dirtyBones;
+		Vector<bool> _dirtyCache;
+		// Per update cache entry, the bone index and its parent's bone index, or -1.
+		Vector<int> _cacheBones;
+		Vector<int> _cacheParents;
+		// The update cache indices of the constraints.
+		Vector<size_t> _cacheConstraints;
+		// The last update cache index of a constraint that changes the bone, or -1.
+		Vector<int> _lastConstrained;
+		// The skeleton position and scale, then the mix values of each constraint in update cache order, as used by the
+		// last incremental update.
+		Vector<float> _trackedState;
+
+		/// Clones a prototype, see clone().
+		explicit Skeleton(Skeleton &prototype);
+
+		/// Constructs the bones, slots and constraints in the arena.
+		void createObjects();
+
+		void adoptOrSortUpdateCache();
+
+		void sortUpdateCache();
+
+		void updateBatches();
+
+		void updateGroups();
+
+		/// Adds the bones a path constraint may read through the path attachment.
+		void addPathAttachmentBones(Attachment *attachment, Vector<int> &bones);
+
+		/// Sets _dirtyBones and _dirtyCache for an incremental update and resets the applied transforms of dirty bones.
+		void markDirty();
+
+		/// Indexes the update cache for markDirty() and clears the tracked state.
+		void indexUpdateCache();
+
+		/// Makes a bone read by the update cache entry at index dirty if a later constraint changes it, returns true if
+		/// it was clean.
+		bool markRead(int bone, size_t index);
+
+		/// Returns true if the values differ from the tracked state at index, then stores them and advances index.
+		bool track(size_t &index, const float *values, size_t count);
+
+		void updateCacheEntry(size_t index);
+
+		/// Returns false if the update cache entry is a constraint of a type that is disabled.
+		bool isEnabled(Updatable *updatable);
+
+		/// Returns false if the prepared update order was recorded before bones or constraints were added or removed.
+		bool isUpdateOrderCurrent(SkeletonData::UpdateOrder &order);
+
+		/// Returns false if a path constraint's target slot has a path attachment the update order did not sort.
+		bool hasSkinPathAttachments(SkeletonData::UpdateOrder &order);
+
+		/// Adopts a prepared update order, returns false if it does not apply to the skeleton's current attachments.
+		bool adoptUpdateOrder(SkeletonData::UpdateOrder &order);
+
+		SkeletonData::UpdateOrder *recordUpdateOrder();
 
 		void sortIkConstraint(IkConstraint *constraint);
 
@@ -42,6 +42,8 @@ namespace spine {
 	public:
 		SkeletonClipping();
 
+		~SkeletonClipping();
+
 		size_t clipStart(Slot &slot, ClippingAttachment *clip);
 
 		void clipEnd(Slot &slot);
@@ -62,6 +64,8 @@ namespace spine {
 
 		Vector<float> &getClippedUVs();
 
+		static void makeClockwise(Vector<float> &polygon);
+
 	private:
 		Triangulator _triangulator;
 		Vector<float> _clippingPolygon;
@@ -72,13 +76,13 @@ namespace spine {
 		Vector<float> _scratch;
 		ClippingAttachment *_clipAttachment;
 		Vector<Vector<float> *> *_clippingPolygons;
+		Vector<Vector<float> *> _worldPolygons;
+		Vector<Vector<float> *> _worldPolygonsStorage;
 
 		/** Clips the input triangle against the convex, clockwise clipping area. If the triangle lies entirely within the clipping
 		  * area, false is returned. The clipping area must duplicate the first vertex at the end of the vertices list. */
 		bool clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> *clippingArea,
 				  Vector<float> *output);
-
-		static void makeClockwise(Vector<float> &polygon);
 	};
 }
 
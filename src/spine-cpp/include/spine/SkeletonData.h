@@ -50,6 +50,8 @@ namespace spine {
 
 	class PathConstraintData;
 
+	class Attachment;
+
 /// Stores the setup pose and all of the stateless data for a skeleton.
 	class SP_API SkeletonData : public SpineObject {
 		friend class SkeletonBinary;
@@ -156,7 +158,42 @@ namespace spine {
 
 		void setFps(float inValue);
 
+		/// Maps the property IDs of all animation timelines to dense indices, so AnimationState can track keyed properties
+		/// with bitsets instead of hashing property IDs. Called by the loaders, call it again after changing the animations.
+		void indexProperties();
+
+		/// The number of distinct properties keyed by the animations, as of the last indexProperties().
+		int getPropertyCount();
+
+		/// Sorts the update cache of a skeleton for no skin and for each skin and stores the results, which
+		/// Skeleton::updateCache() adopts in O(bones) instead of sorting. Called by the loaders, call it again after
+		/// changing the bones, constraints or skins. Skeletons only read the orders, so they can be created and updated on
+		/// several threads, but this must not be called while skeletons of this data are created or updated.
+		void prepareUpdateOrders();
+
+		/// Discards the update orders, skeletons sort their update caches again. Must not be called while skeletons of this
+		/// data are created or updated.
+		void clearUpdateOrders();
+
 	private:
+		/// The update cache Skeleton::updateCache() computed for a skin, stored so skeletons can adopt it in O(bones).
+		class UpdateOrder : public SpineObject {
+		public:
+			/// Bone, IK, transform or path constraint index shifted left by 2, or'ed with UpdateBone, UpdateIk, UpdateTransform or UpdatePath.
+			Vector<int> _updateCache;
+			Vector<bool> _activeBones;
+			size_t _ikCount, _transformCount, _pathCount;
+			/// The path attachments of the skins for the slot of each path constraint, as slot index and attachment pairs.
+			Vector<int> _pathSlots;
+			Vector<Attachment *> _pathAttachments;
+
+			static const int UpdateBone = 0;
+			static const int UpdateIk = 1;
+			static const int UpdateTransform = 2;
+			static const int UpdatePath = 3;
+		};
+
+
 		String _name;
 		Vector<BoneData *> _bones; // Ordered parents first
 		Vector<SlotData *> _slots; // Setup pose draw order.
@@ -171,6 +208,8 @@ namespace spine {
 		String _version;
 		String _hash;
 		Vector<char *> _strings;
+		int _propertyCount;
+		Vector<UpdateOrder *> _updateOrders; // Indexed by skin index + 1, 0 for no skin.
 
 		// Nonessential.
 		float _fps;
@@ -0,0 +1,93 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonInterpolator_h
+#define Spine_SkeletonInterpolator_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class AnimationState;
+
+	class Skeleton;
+
+	/// Evaluates a skeleton only every few frames, eg for skeletons in the distance, and interpolates the world
+	/// transforms of the last two evaluations on the frames in between. The skeleton is drawn one interval minus a
+	/// frame behind its animation state. Rotations are interpolated as matrices, so bones that rotate by large angles
+	/// within an interval shrink slightly in between.
+	///
+	/// Only the bone world transforms are interpolated. Slot attachments, colors, deforms and the draw order keep the
+	/// state of the last evaluation, so they change up to an interval before the bones arrive at the pose they were
+	/// keyed with. Use intervals above 1 only for skeletons whose animations key no such changes, or where an early
+	/// change is not noticeable, eg crowds in the distance.
+	///
+	/// Each frame, call beginFrame(). If it returns true, pose the skeleton with AnimationState::apply() and
+	/// Skeleton::updateWorldTransform(), otherwise call AnimationState::applyEvents() so events fire on time. Then call
+	/// endFrame().
+	class SP_API SkeletonInterpolator : public SpineObject {
+	public:
+		/// @param state May be NULL. When set, the skeleton is also evaluated on frames that apply changes the later
+		/// evaluations would not make, see AnimationState::isApplyRequired().
+		/// @param interval The skeleton is evaluated every interval frames, 1 evaluates every frame.
+		/// @param phase The frame within the interval on which the skeleton is evaluated, eg different for each
+		/// skeleton of a crowd to spread the evaluations over the frames.
+		/// Frames are counted from the first beginFrame().
+		SkeletonInterpolator(Skeleton &skeleton, AnimationState *state, int interval, int phase);
+
+		/// Starts a frame, returns true if the skeleton is evaluated in the frame.
+		bool beginFrame();
+
+		/// Stores the world transforms of an evaluated frame, then sets the world transforms interpolated for the frame.
+		void endFrame();
+
+		/// Evaluates the skeleton on the next frame without interpolating from the previous evaluation, eg after it was
+		/// moved to a new position.
+		void reset();
+
+		void setInterval(int interval, int phase);
+
+		int getInterval();
+
+		int getPhase();
+
+		Skeleton &getSkeleton();
+
+	private:
+		Skeleton &_skeleton;
+		AnimationState *_state;
+		int _interval, _phase;
+		int _frame, _elapsed;
+		bool _evaluate, _valid;
+		// The world transform components of the previous and the last evaluation, see SkeletonPose.
+		Vector<float> _from, _to;
+	};
+}
+
+#endif /* Spine_SkeletonInterpolator_h */
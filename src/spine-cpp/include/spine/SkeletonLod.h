@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonLod_h
+#define Spine_SkeletonLod_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class AnimationState;
+
+	class Skeleton;
+
+	class SkeletonBounds;
+
+	class SkeletonRenderer;
+
+	/// Work a level of a SkeletonLod skips, as bit flags.
+	enum LodFeature {
+		LodFeature_IkConstraints = 1,
+		LodFeature_TransformConstraints = 2,
+		LodFeature_PathConstraints = 4,
+		/// Meshes keep their setup pose shape, see AnimationState::setDeformTimelinesEnabled().
+		LodFeature_DeformTimelines = 8,
+		/// Meshes are drawn as the polygon of their hull, see SkeletonRenderer::setSimplifyMeshes().
+		LodFeature_Meshes = 16
+	};
+
+	/// Level of detail settings, usually shared by the skeletons of a SkeletonData. Level 0 is full detail, each
+	/// added level is used below a smaller size on screen and skips more work, so skeletons in the background cost
+	/// a fraction of those in the foreground.
+	class SP_API SkeletonLod : public SpineObject {
+	public:
+		SkeletonLod();
+
+		/// Adds a level, levels must be added from the largest to the smallest size.
+		/// @param size The level is used when the skeleton's size on screen is less than this.
+		/// @param disabledFeatures The LodFeature flags of the work the level skips.
+		/// @param minTrackAlpha See AnimationState::setMinTrackAlpha().
+		void addLevel(float size, int disabledFeatures, float minTrackAlpha);
+
+		/// The number of levels, including level 0.
+		size_t getLevelCount();
+
+		float getSize(size_t level);
+
+		int getDisabledFeatures(size_t level);
+
+		float getMinTrackAlpha(size_t level);
+
+		/// Returns the level for a size on screen, eg the larger side of the projected bounds of the skeleton.
+		size_t getLevel(float size);
+
+		/// Returns the level for the larger side of the bounds from the last SkeletonBounds::update(), which requires
+		/// bounding box attachments.
+		/// @param scale The size on screen of one skeleton unit.
+		size_t getLevel(SkeletonBounds &bounds, float scale);
+
+		/// Configures a skeleton and the objects that pose and draw it for the level. The deform of the slots is
+		/// cleared when deform timelines become disabled, so meshes do not freeze in their current shape.
+		/// @param state May be NULL.
+		/// @param renderer May be NULL.
+		void apply(size_t level, Skeleton &skeleton, AnimationState *state, SkeletonRenderer *renderer);
+
+	private:
+		Vector<float> _sizes;
+		Vector<int> _disabledFeatures;
+		Vector<float> _minTrackAlphas;
+	};
+}
+
+#endif /* Spine_SkeletonLod_h */
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonPool_h
+#define Spine_SkeletonPool_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Skeleton;
+
+	/// Spawns skeletons from a prototype. New skeletons are cloned from the prototype and freed skeletons are kept and
+	/// set to the prototype's state when obtained again, so spawning reuses their allocations. See Skeleton::clone().
+	class SP_API SkeletonPool : public SpineObject {
+	public:
+		/// @param prototype Must outlive the pool. Obtained skeletons have the prototype's state at the time.
+		explicit SkeletonPool(Skeleton &prototype);
+
+		/// Deletes the free skeletons. Obtained skeletons must be deleted by their owner.
+		~SkeletonPool();
+
+		/// Returns a free skeleton set to the prototype's state, or a clone of the prototype if none is free.
+		Skeleton *obtain();
+
+		/// Makes a skeleton obtained from this pool available to obtain() again.
+		void free(Skeleton *skeleton);
+
+		/// Clones the prototype until count skeletons are free, eg before a wave of spawns.
+		void fill(size_t count);
+
+		size_t getFreeCount();
+
+		Skeleton &getPrototype();
+
+	private:
+		Skeleton &_prototype;
+		Vector<Skeleton *> _free;
+	};
+}
+
+#endif /* Spine_SkeletonPool_h */
@@ -0,0 +1,130 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonPose_h
+#define Spine_SkeletonPose_h
+
+#include <spine/SpineObject.h>
+
+#include <stddef.h>
+
+namespace spine {
+	/// A component of a bone pose, see SkeletonPose.
+	enum PoseComponent {
+		// Local transform.
+		PoseComponent_X = 0,
+		PoseComponent_Y,
+		PoseComponent_Rotation,
+		PoseComponent_ScaleX,
+		PoseComponent_ScaleY,
+		PoseComponent_ShearX,
+		PoseComponent_ShearY,
+		// Applied transform.
+		PoseComponent_AX,
+		PoseComponent_AY,
+		PoseComponent_ARotation,
+		PoseComponent_AScaleX,
+		PoseComponent_AScaleY,
+		PoseComponent_AShearX,
+		PoseComponent_AShearY,
+		// World transform.
+		PoseComponent_A,
+		PoseComponent_B,
+		PoseComponent_C,
+		PoseComponent_D,
+		PoseComponent_WorldX,
+		PoseComponent_WorldY,
+		PoseComponent_Count
+	};
+
+	/// Stores the poses of all bones of a skeleton as a structure of arrays: one contiguous array per PoseComponent,
+	/// indexed by bone index. The pose accessors of each Bone index into these arrays, so passes over many bones, eg
+	/// computing world transforms or skinning, can work on cache resident data that is laid out for SIMD.
+	class SP_API SkeletonPose : public SpineObject {
+	public:
+		explicit SkeletonPose(size_t boneCount);
+
+		~SkeletonPose();
+
+		size_t getBoneCount();
+
+		/// The number of floats from the start of one component array to the next, a multiple of 8 so each array
+		/// starts on a 32 byte boundary relative to the first.
+		size_t getStride();
+
+		/// The array for the component, with one entry per bone index.
+		inline float *getComponent(PoseComponent component) {
+			return _buffer + component * _stride;
+		}
+
+		/// Copies all components of a pose with the same bone count.
+		void set(SkeletonPose &pose);
+
+		/// Copies the local transforms of the first count bones to their applied transforms.
+		void setAppliedToLocal(size_t count);
+
+		/// Copies the local transforms of the bones for which bones is true to their applied transforms.
+		/// @param bones One entry per bone index.
+		void setAppliedToLocal(const bool *bones, size_t count);
+
+		/// Compares the local transforms of the first count bones with the copy taken by the last call, sets changed for
+		/// each bone that differs and updates the copy. On the first call all bones are changed.
+		/// @param changed One entry per bone index.
+		/// @return The number of changed bones.
+		size_t findLocalChanges(bool *changed, size_t count);
+
+		/// Stores the local matrices of TransformMode_Normal bones, computed from their applied transforms, in their
+		/// A, B, C and D components for a following updateWorldTransforms(). The sines and cosines are computed with the
+		/// batched MathUtil::sinCosDeg(), so all bones whose applied transforms are final should be passed at once.
+		/// @param bones The bone indices.
+		void updateLocalTransforms(const int *bones, size_t count);
+
+		/// Computes the world transforms of TransformMode_Normal bones from the local matrices stored by
+		/// updateLocalTransforms() and the world transforms of their parents, like Bone::update(). No bone may be the
+		/// parent of another bone in the batch. The matrix products are computed 8 or 4 bones at a time with AVX, SSE
+		/// or NEON when available. The results are the same as Bone::update(), unless the compiler fuses the scalar
+		/// multiply adds.
+		/// @param bones The bone indices.
+		/// @param parents The bone indices of the parents, one per bone.
+		void updateWorldTransforms(const int *bones, const int *parents, size_t count);
+
+	private:
+		float *_buffer;
+		float *_lastLocal;
+		size_t _boneCount;
+		size_t _stride;
+
+		// Owns its buffers, use set() to copy a pose.
+		SkeletonPose(const SkeletonPose &);
+
+		SkeletonPose &operator=(const SkeletonPose &);
+	};
+}
+
+#endif /* Spine_SkeletonPose_h */
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonRenderer_h
+#define Spine_SkeletonRenderer_h
+
+#include <spine/BlendMode.h>
+#include <spine/SkeletonClipping.h>
+#include <spine/Vector.h>
+
+#include <stdint.h>
+
+namespace spine {
+	class Skeleton;
+
+	/// Interleaved 20 byte vertex written by the SkeletonRenderer. The color is packed as 8 bit normalized
+	/// components laid out r, g, b, a in memory, see packColor().
+	struct SP_API RenderVertex {
+		float x, y;
+		float u, v;
+		uint32_t color;
+	};
+
+	/// A batch of triangles sharing the same texture and blend mode. The indices of a command address the
+	/// vertices starting at firstVertex, so a backend can upload each command as is or rebase it onto its own stream.
+	struct SP_API RenderCommand {
+		/// The renderer object of the atlas page the attachments are mapped to.
+		void *texture;
+		BlendMode blendMode;
+		size_t firstVertex;
+		size_t numVertices;
+		size_t firstIndex;
+		size_t numIndices;
+	};
+
+	/// Turns skeletons into a flat list of render commands without touching any graphics API. Attachment traversal,
+	/// clipping and color computation happen here, a thin backend consumes the resulting vertices, indices and commands.
+	/// A renderer holds no global state, so separate instances can record different skeletons on different threads.
+	class SP_API SkeletonRenderer : public SpineObject {
+	public:
+		SkeletonRenderer();
+
+		~SkeletonRenderer();
+
+		/// Appends the geometry of the skeleton's visible region and mesh attachments, in draw order. Consecutive
+		/// attachments sharing the same texture and blend mode are merged into one command.
+		void render(Skeleton &skeleton);
+
+		/// When true, meshes are drawn as the polygon of their hull, see MeshAttachment::getHullLength(), so only the
+		/// hull vertices are computed, eg for skeletons that are drawn small, see SkeletonLod. The triangles of each
+		/// hull are computed the first time it is drawn, see MeshAttachment::getHullTriangles(). Default is false.
+		void setSimplifyMeshes(bool simplify);
+
+		bool getSimplifyMeshes();
+
+		/// Removes all recorded vertices, indices and commands, keeping their memory for the next frame.
+		void clear();
+
+		Vector<RenderVertex> &getVertices();
+
+		Vector<unsigned short> &getIndices();
+
+		Vector<RenderCommand> &getCommands();
+
+		/// Packs a color with components in [0, 1] into the byte layout of RenderVertex::color.
+		static uint32_t packColor(float r, float g, float b, float a);
+
+	private:
+		SkeletonClipping _clipper;
+		bool _simplifyMeshes;
+		Vector<float> _worldVertices;
+		Vector<unsigned short> _quadIndices;
+		Vector<RenderVertex> _vertices;
+		Vector<unsigned short> _indices;
+		Vector<RenderCommand> _commands;
+	};
+}
+
+#endif /* Spine_SkeletonRenderer_h */
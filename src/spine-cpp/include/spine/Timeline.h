@@ -72,12 +72,19 @@ namespace spine {
 
 		float getDuration();
 
+		/// The bytes allocated for the keys.
+		virtual size_t getMemorySize();
+
 		virtual Vector <PropertyId> &getPropertyIds();
 
+		/// The dense indices of the property IDs, assigned by SkeletonData::indexProperties().
+		Vector<int> &getPropertyIndices();
+
 	protected:
 		void setPropertyIds(PropertyId propertyIds[], size_t propertyIdsCount);
 
 		Vector <PropertyId> _propertyIds;
+		Vector<int> _propertyIndices;
 		Vector<float> _frames;
 		size_t _frameEntries;
 	};
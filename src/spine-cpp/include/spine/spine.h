@@ -39,6 +39,8 @@
 #include <spine/AttachmentLoader.h>
 #include <spine/AttachmentTimeline.h>
 #include <spine/AttachmentType.h>
+#include <spine/BakedAnimation.h>
+#include <spine/BatchedTimelines.h>
 #include <spine/BlendMode.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
@@ -73,6 +75,7 @@
 #include <spine/PathConstraintPositionTimeline.h>
 #include <spine/PathConstraintSpacingTimeline.h>
 #include <spine/PointAttachment.h>
+#include <spine/PoseCache.h>
 #include <spine/Pool.h>
 #include <spine/PositionMode.h>
 #include <spine/RegionAttachment.h>
@@ -86,7 +89,12 @@
 #include <spine/SkeletonBounds.h>
 #include <spine/SkeletonClipping.h>
 #include <spine/SkeletonData.h>
+#include <spine/SkeletonInterpolator.h>
 #include <spine/SkeletonJson.h>
+#include <spine/SkeletonLod.h>
+#include <spine/SkeletonPool.h>
+#include <spine/SkeletonPose.h>
+#include <spine/SkeletonRenderer.h>
 #include <spine/Skin.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
@@ -28,7 +28,16 @@
  *****************************************************************************/
 
 #include <spine/Animation.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/BakedAnimation.h>
+#include <spine/BatchedTimelines.h>
+#include <spine/CurveTimeline.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
 #include <spine/Event.h>
+#include <spine/EventTimeline.h>
+#include <spine/MathUtil.h>
+#include <spine/RotateTimeline.h>
 #include <spine/Skeleton.h>
 #include <spine/Timeline.h>
 
@@ -38,26 +47,64 @@
 
 using namespace spine;
 
+static TimelineKind getTimelineKind(Timeline *timeline) {
+	const RTTI &rtti = timeline->getRTTI();
+	if (rtti.isExactly(RotateTimeline::rtti)) return TimelineKind_Rotate;
+	if (rtti.isExactly(AttachmentTimeline::rtti)) return TimelineKind_Attachment;
+	if (rtti.isExactly(DrawOrderTimeline::rtti)) return TimelineKind_DrawOrder;
+	if (rtti.isExactly(DeformTimeline::rtti)) return TimelineKind_Deform;
+	if (rtti.isExactly(EventTimeline::rtti)) return TimelineKind_Event;
+	return TimelineKind_Other;
+}
+
 Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
 																						  _timelineIds(),
+																						  _propertyIndexOwner(NULL),
 																						  _duration(duration),
-																						  _name(name) {
+																						  _name(name),
+																						  _baked(NULL),
+																						  _batched(NULL),
+																						  _compressionError(0) {
 	assert(_name.length() > 0);
+	_timelineKinds.ensureCapacity(timelines.size());
 	for (size_t i = 0; i < timelines.size(); i++) {
-		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
+		Vector<PropertyId> &propertyIds = timelines[i]->getPropertyIds();
 		for (size_t ii = 0; ii < propertyIds.size(); ii++)
 			_timelineIds.put(propertyIds[ii], true);
+		_timelineKinds.add((unsigned char) getTimelineKind(timelines[i]));
 	}
 }
 
-bool Animation::hasTimeline(Vector<PropertyId> ids) {
+bool Animation::hasTimeline(Vector<PropertyId> &ids) {
 	for (size_t i = 0; i < ids.size(); i++) {
 		if (_timelineIds.containsKey(ids[i])) return true;
 	}
 	return false;
 }
 
+void Animation::indexProperties(SkeletonData *owner, int propertyCount) {
+	_propertyIndexOwner = owner;
+	_propertyBits.setSize((propertyCount + 31) >> 5, 0);
+	for (size_t i = 0, n = _propertyBits.size(); i < n; i++)
+		_propertyBits[i] = 0;
+	for (size_t i = 0, n = _timelines.size(); i < n; i++) {
+		Vector<int> &indices = _timelines[i]->getPropertyIndices();
+		for (size_t ii = 0, nn = indices.size(); ii < nn; ii++)
+			_propertyBits[indices[ii] >> 5] |= 1u << (indices[ii] & 31);
+	}
+}
+
+bool Animation::hasProperty(Vector<int> &propertyIndices) {
+	for (size_t i = 0, n = propertyIndices.size(); i < n; i++) {
+		int index = propertyIndices[i];
+		if (_propertyBits[index >> 5] & (1u << (index & 31))) return true;
+	}
+	return false;
+}
+
 Animation::~Animation() {
+	delete _baked;
+	delete _batched;
 	ContainerUtil::cleanUpVectorOfPointers(_timelines);
 }
 
@@ -70,11 +117,74 @@ void Animation::apply(Skeleton &skeleton, float lastTime, float time, bool loop,
 		}
 	}
 
+	if (_batched) {
+		_batched->apply(skeleton, time, alpha, blend, direction, NULL, NULL);
+		Vector<bool> &grouped = _batched->getGrouped();
+		for (size_t i = 0, n = _timelines.size(); i < n; ++i) {
+			if (grouped[i]) continue;
+			_timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
+		}
+		return;
+	}
+
 	for (size_t i = 0, n = _timelines.size(); i < n; ++i) {
 		_timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
 	}
 }
 
+BakedAnimation *Animation::bake(float fps, float maxError) {
+	unbake();
+	_baked = new (__FILE__, __LINE__) BakedAnimation(*this, fps, maxError);
+	return _baked;
+}
+
+void Animation::unbake() {
+	delete _baked;
+	_baked = NULL;
+}
+
+BakedAnimation *Animation::getBaked() {
+	return _baked;
+}
+
+BatchedTimelines *Animation::batch() {
+	unbatch();
+	_batched = new (__FILE__, __LINE__) BatchedTimelines(*this);
+	return _batched;
+}
+
+void Animation::unbatch() {
+	delete _batched;
+	_batched = NULL;
+}
+
+BatchedTimelines *Animation::getBatched() {
+	return _batched;
+}
+
+float Animation::compress(int bits, float tolerance) {
+	for (size_t i = 0, n = _timelines.size(); i < n; ++i) {
+		Timeline *timeline = _timelines[i];
+		const RTTI &rtti = timeline->getRTTI();
+		if (!rtti.instanceOf(CurveTimeline1::rtti) && !rtti.instanceOf(CurveTimeline2::rtti)) continue;
+		CurveTimeline *curveTimeline = static_cast<CurveTimeline *>(timeline);
+		if (curveTimeline->isCompressed()) continue;
+		_compressionError = MathUtil::max(_compressionError, curveTimeline->compress(bits, tolerance));
+	}
+	return _compressionError;
+}
+
+float Animation::getCompressionError() {
+	return _compressionError;
+}
+
+size_t Animation::getMemorySize() {
+	size_t size = 0;
+	for (size_t i = 0, n = _timelines.size(); i < n; ++i)
+		size += _timelines[i]->getMemorySize();
+	return size;
+}
+
 const String &Animation::getName() {
 	return _name;
 }
@@ -83,6 +193,10 @@ Vector<Timeline *> &Animation::getTimelines() {
 	return _timelines;
 }
 
+Vector<unsigned char> &Animation::getTimelineKinds() {
+	return _timelineKinds;
+}
+
 float Animation::getDuration() {
 	return _duration;
 }
@@ -91,17 +205,52 @@ void Animation::setDuration(float inValue) {
 	_duration = inValue;
 }
 
-int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
-	for (size_t i = 1; i < n; i++) {
-		if (frames[i] > target) return (int) (i - 1);
+static thread_local int *searchCursor = NULL;
+
+static thread_local const float *bakedValues = NULL;
+
+/// Returns the last frame, from the second one on, that is not after the target, or the first frame.
+static int binarySearch(Vector<float> &frames, float target, int step) {
+	int low = 0, high = (int) frames.size() / step - 1;
+	while (low < high) {
+		int middle = (low + high + 1) >> 1;
+		if (frames[middle * step] <= target)
+			low = middle;
+		else
+			high = middle - 1;
 	}
-	return (int) (n - 1);
+	return low * step;
+}
+
+int Animation::search(Vector<float> &frames, float target) {
+	return search(frames, target, 1);
 }
 
 int Animation::search(Vector<float> &frames, float target, int step) {
-	size_t n = frames.size();
-	for (size_t i = step; i < n; i += step)
-		if (frames[i] > target) return (int) (i - step);
-	return (int) (n - step);
+	int *cursor = searchCursor;
+	if (cursor == NULL) return binarySearch(frames, target, step);
+
+	int n = (int) frames.size(), i = *cursor;
+	if (i >= 0 && i < n && (i == 0 || frames[i] <= target)) {
+		// Playing forward stays on the cursor frame or moves to the next one.
+		if (i + step >= n || frames[i + step] > target) return i;
+		i += step;
+		if (i + step >= n || frames[i + step] > target) {
+			*cursor = i;
+			return i;
+		}
+	}
+	return *cursor = binarySearch(frames, target, step);
+}
+
+void Animation::setSearchCursor(int *cursor) {
+	searchCursor = cursor;
+}
+
+void Animation::setBakedValues(const float *values) {
+	bakedValues = values;
+}
+
+const float *Animation::getBakedValues() {
+	return bakedValues;
 }
@@ -31,11 +31,14 @@
 #include <spine/Animation.h>
 #include <spine/AnimationStateData.h>
 #include <spine/AttachmentTimeline.h>
+#include <spine/BakedAnimation.h>
+#include <spine/BatchedTimelines.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
 #include <spine/DrawOrderTimeline.h>
 #include <spine/Event.h>
 #include <spine/EventTimeline.h>
+#include <spine/PoseCache.h>
 #include <spine/RotateTimeline.h>
 #include <spine/Skeleton.h>
 #include <spine/SkeletonData.h>
@@ -192,6 +195,7 @@ void TrackEntry::reset() {
 	_timelineMode.clear();
 	_timelineHoldMix.clear();
 	_timelinesRotation.clear();
+	_timelinesCursor.clear();
 
 	_listener = dummyOnAnimationEventFunc;
 	_listenerObject = NULL;
@@ -316,11 +320,15 @@ void EventQueue::drain() {
 
 AnimationState::AnimationState(AnimationStateData *data) : _data(data),
 														   _queue(EventQueue::newEventQueue(*this, _trackEntryPool)),
+														   _propertyIndexOwner(NULL),
 														   _animationsChanged(false),
 														   _listener(dummyOnAnimationEventFunc),
 														   _listenerObject(NULL),
 														   _unkeyedState(0),
-														   _timeScale(1) {
+														   _timeScale(1),
+														   _minTrackAlpha(0),
+														   _deformTimelines(true),
+														   _poseCache(NULL) {
 }
 
 AnimationState::~AnimationState() {
@@ -446,10 +454,31 @@ bool AnimationState::apply(Skeleton &skeleton) {
 		}
 		size_t timelineCount = current._animation->_timelines.size();
 		Vector<Timeline *> &timelines = current._animation->_timelines;
-		if ((i == 0 && mix == 1) || blend == MixBlend_Add) {
+		if (current._timelinesCursor.size() != timelineCount) current._timelinesCursor.setSize(timelineCount, 0);
+		int *timelinesCursor = current._timelinesCursor.buffer();
+		const unsigned char *timelineKinds = current._animation->_timelineKinds.buffer();
+		sampleBakedValues(current, applyTime);
+		if (i > 0 && mix < _minTrackAlpha && current._trackTime < current._trackEnd) {
+			// Too faint to show, only fire the events.
+			applyEventTimelines(current, skeleton, applyTime, applyEvents);
+		} else if ((i == 0 && mix == 1) || blend == MixBlend_Add) {
+			const bool *cached = NULL;
+			if (_poseCache && i == 0 && mix == 1)
+				cached = _poseCache->apply(*current._animation, skeleton, applyTime, blend);
+			const bool *grouped = NULL;
+			BatchedTimelines *batched = current._animation->_batched;
+			if (batched) {
+				batched->apply(skeleton, applyTime, mix, blend, MixDirection_In, timelinesCursor, cached);
+				grouped = batched->getGrouped().buffer();
+			}
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
 				Timeline *timeline = timelines[ii];
-				if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
+				if (cached && cached[ii]) continue;
+				if (grouped && grouped[ii]) continue;
+				int kind = timelineKinds[ii];
+				if (!_deformTimelines && kind == TimelineKind_Deform) continue;
+				Animation::setSearchCursor(timelinesCursor + ii);
+				if (kind == TimelineKind_Attachment)
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, blend,
 											true);
 				else
@@ -466,13 +495,16 @@ bool AnimationState::apply(Skeleton &skeleton) {
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
 				Timeline *timeline = timelines[ii];
 				assert(timeline);
+				int kind = timelineKinds[ii];
+				if (!_deformTimelines && kind == TimelineKind_Deform) continue;
 
 				MixBlend timelineBlend = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
+				Animation::setSearchCursor(timelinesCursor + ii);
 
-				if (!shortestRotation && timeline->getRTTI().isExactly(RotateTimeline::rtti))
+				if (!shortestRotation && kind == TimelineKind_Rotate)
 					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, applyTime, mix,
 										timelineBlend, timelinesRotation, ii << 1, firstFrame);
-				else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
+				else if (kind == TimelineKind_Attachment)
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime,
 											timelineBlend, true);
 				else
@@ -480,6 +512,8 @@ bool AnimationState::apply(Skeleton &skeleton) {
 									MixDirection_In);
 			}
 		}
+		Animation::setSearchCursor(NULL);
+		Animation::setBakedValues(NULL);
 
 		queueEvents(currentP, animationTime);
 		_events.clear();
@@ -648,6 +682,30 @@ void AnimationState::setTimeScale(float inValue) {
 	_timeScale = inValue;
 }
 
+float AnimationState::getMinTrackAlpha() {
+	return _minTrackAlpha;
+}
+
+void AnimationState::setMinTrackAlpha(float inValue) {
+	_minTrackAlpha = inValue;
+}
+
+bool AnimationState::isDeformTimelinesEnabled() {
+	return _deformTimelines;
+}
+
+void AnimationState::setDeformTimelinesEnabled(bool inValue) {
+	_deformTimelines = inValue;
+}
+
+PoseCache *AnimationState::getPoseCache() {
+	return _poseCache;
+}
+
+void AnimationState::setPoseCache(PoseCache *inValue) {
+	_poseCache = inValue;
+}
+
 void AnimationState::setListener(AnimationStateListener inValue) {
 	_listener = inValue;
 	_listenerObject = NULL;
@@ -666,6 +724,10 @@ void AnimationState::enableQueue() {
 	_queue->_drainDisabled = false;
 }
 
+void AnimationState::drainQueue() {
+	_queue->drain();
+}
+
 Animation *AnimationState::getEmptyAnimation() {
 	static Vector<Timeline *> timelines;
 	static Animation ret(String("<empty>"), timelines, 0);
@@ -707,15 +769,15 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 	if (time < frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_rotation = bone->_data._rotation;
+				bone->_rotation() = bone->_data._rotation;
 			default:
 				return;
 			case MixBlend_First:
-				r1 = bone->_rotation;
+				r1 = bone->_rotation();
 				r2 = bone->_data._rotation;
 		}
 	} else {
-		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_rotation;
+		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_rotation();
 		r2 = bone->_data._rotation + rotateTimeline->getCurveValue(time);
 	}
 
@@ -749,7 +811,7 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 		timelinesRotation[i] = total;
 	}
 	timelinesRotation[i + 1] = diff;
-	bone->_rotation = r1 + total * alpha;
+	bone->_rotation() = r1 + total * alpha;
 }
 
 bool AnimationState::updateMixingFrom(TrackEntry *to, float delta) {
@@ -781,6 +843,89 @@ bool AnimationState::updateMixingFrom(TrackEntry *to, float delta) {
 	return false;
 }
 
+bool AnimationState::applyEvents(Skeleton &skeleton) {
+	bool applied = false;
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *currentP = _tracks[i];
+		if (currentP == NULL || currentP->_delay > 0) {
+			continue;
+		}
+
+		TrackEntry &current = *currentP;
+		applied = true;
+		if (current._mixingFrom != NULL) applyMixingFromEvents(currentP, skeleton);
+
+		float animationTime = current.getAnimationTime();
+		if (!current._reverse) applyEventTimelines(current, skeleton, animationTime, &_events);
+
+		queueEvents(currentP, animationTime);
+		_events.clear();
+		current._nextAnimationLast = animationTime;
+		current._nextTrackLast = current._trackTime;
+	}
+
+	_queue->drain();
+	return applied;
+}
+
+bool AnimationState::isApplyRequired() {
+	if (_animationsChanged) return true;
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *current = _tracks[i];
+		if (current == NULL || current->_delay > 0) continue;
+		// The last application sets the setup pose.
+		if (current->_trackTime >= current->_trackEnd && current->_next == NULL) return true;
+		// The last application of a mix fully applies the entry mixed to.
+		for (TrackEntry *to = current; to->_mixingFrom != NULL; to = to->_mixingFrom)
+			if (to->_mixTime >= to->_mixDuration) return true;
+	}
+	return false;
+}
+
+void AnimationState::applyMixingFromEvents(TrackEntry *to, Skeleton &skeleton) {
+	TrackEntry *from = to->_mixingFrom;
+	if (from->_mixingFrom != NULL) applyMixingFromEvents(from, skeleton);
+
+	float mix = to->_mixDuration == 0 ? 1 : MathUtil::min(1.0f, to->_mixTime / to->_mixDuration);
+	float animationTime = from->getAnimationTime();
+	if (!from->_reverse && mix < from->_eventThreshold) applyEventTimelines(*from, skeleton, animationTime, &_events);
+
+	if (to->_mixDuration > 0) {
+		queueEvents(from, animationTime);
+	}
+
+	_events.clear();
+	from->_nextAnimationLast = animationTime;
+	from->_nextTrackLast = from->_trackTime;
+}
+
+void AnimationState::applyEventTimelines(TrackEntry &entry, Skeleton &skeleton, float applyTime,
+										 Vector<Event *> *events) {
+	Vector<Timeline *> &timelines = entry._animation->_timelines;
+	size_t timelineCount = timelines.size();
+	if (entry._timelinesCursor.size() != timelineCount) entry._timelinesCursor.setSize(timelineCount, 0);
+	int *timelinesCursor = entry._timelinesCursor.buffer();
+	const unsigned char *timelineKinds = entry._animation->_timelineKinds.buffer();
+	for (size_t i = 0; i < timelineCount; ++i) {
+		Timeline *timeline = timelines[i];
+		if (timelineKinds[i] != TimelineKind_Event) continue;
+		Animation::setSearchCursor(timelinesCursor + i);
+		timeline->apply(skeleton, entry._animationLast, applyTime, events, 1, MixBlend_Replace, MixDirection_In);
+	}
+	Animation::setSearchCursor(NULL);
+}
+
+void AnimationState::sampleBakedValues(TrackEntry &entry, float applyTime) {
+	BakedAnimation *baked = entry._animation->_baked;
+	if (!baked) {
+		Animation::setBakedValues(NULL);
+		return;
+	}
+	if (entry._bakedValues.size() != baked->getStride()) entry._bakedValues.setSize(baked->getStride(), 0);
+	baked->sample(applyTime, entry._bakedValues.buffer());
+	Animation::setBakedValues(entry._bakedValues.buffer());
+}
+
 float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBlend blend) {
 	TrackEntry *from = to->_mixingFrom;
 	if (from->_mixingFrom != NULL) applyMixingFrom(from, skeleton, blend);
@@ -811,9 +956,17 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 		if (mix < from->_eventThreshold) events = &_events;
 	}
 
+	if (from->_timelinesCursor.size() != timelineCount) from->_timelinesCursor.setSize(timelineCount, 0);
+	int *timelinesCursor = from->_timelinesCursor.buffer();
+	const unsigned char *timelineKinds = from->_animation->_timelineKinds.buffer();
+	sampleBakedValues(*from, applyTime);
 	if (blend == MixBlend_Add) {
-		for (size_t i = 0; i < timelineCount; i++)
-			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+		for (size_t i = 0; i < timelineCount; i++) {
+			Timeline *timeline = timelines[i];
+			if (!_deformTimelines && timelineKinds[i] == TimelineKind_Deform) continue;
+			Animation::setSearchCursor(timelinesCursor + i);
+			timeline->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+		}
 	} else {
 		Vector<int> &timelineMode = from->_timelineMode;
 		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
@@ -827,12 +980,13 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 		from->_totalAlpha = 0;
 		for (size_t i = 0; i < timelineCount; i++) {
 			Timeline *timeline = timelines[i];
+			int kind = timelineKinds[i];
 			MixDirection direction = MixDirection_Out;
 			MixBlend timelineBlend;
 			float alpha;
 			switch (timelineMode[i]) {
 				case Subsequent:
-					if (!drawOrder && (timeline->getRTTI().isExactly(DrawOrderTimeline::rtti))) continue;
+					if (!drawOrder && kind == TimelineKind_DrawOrder) continue;
 					timelineBlend = blend;
 					alpha = alphaMix;
 					break;
@@ -855,20 +1009,23 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 					break;
 			}
 			from->_totalAlpha += alpha;
-			if (!shortestRotation && (timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
+			if (!_deformTimelines && kind == TimelineKind_Deform) continue;
+			Animation::setSearchCursor(timelinesCursor + i);
+			if (!shortestRotation && kind == TimelineKind_Rotate) {
 				applyRotateTimeline((RotateTimeline *) timeline, skeleton, applyTime, alpha, timelineBlend,
 									timelinesRotation, i << 1, firstFrame);
-			} else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
+			} else if (kind == TimelineKind_Attachment) {
 				applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, timelineBlend,
 										attachments);
 			} else {
-				if (drawOrder && timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) &&
-					timelineBlend == MixBlend_Setup)
+				if (drawOrder && kind == TimelineKind_DrawOrder && timelineBlend == MixBlend_Setup)
 					direction = MixDirection_In;
 				timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction);
 			}
 		}
 	}
+	Animation::setSearchCursor(NULL);
+	Animation::setBakedValues(NULL);
 
 	if (to->_mixDuration > 0) {
 		queueEvents(from, animationTime);
@@ -997,7 +1154,27 @@ void AnimationState::clearNext(TrackEntry *entry) {
 void AnimationState::animationsChanged() {
 	_animationsChanged = false;
 
-	_propertyIDs.clear();
+	// Use bitsets when all animations share the property indices of one SkeletonData, else fall back to property IDs.
+	SkeletonData *owner = NULL;
+	bool shared = true;
+	for (size_t i = 0, n = _tracks.size(); i < n && shared; ++i) {
+		for (TrackEntry *entry = _tracks[i]; entry != NULL; entry = entry->_mixingFrom) {
+			Animation *animation = entry->_animation;
+			if (animation->_timelines.size() == 0) continue;
+			if (animation->_propertyIndexOwner == NULL || (owner != NULL && animation->_propertyIndexOwner != owner)) {
+				shared = false;
+				break;
+			}
+			owner = animation->_propertyIndexOwner;
+		}
+	}
+	_propertyIndexOwner = shared ? owner : NULL;
+	if (_propertyIndexOwner) {
+		_propertyBits.setSize((owner->getPropertyCount() + 31) >> 5, 0);
+		for (size_t i = 0, n = _propertyBits.size(); i < n; i++)
+			_propertyBits[i] = 0;
+	} else
+		_propertyIDs.clear();
 
 	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
 		TrackEntry *entry = _tracks[i];
@@ -1016,6 +1193,7 @@ void AnimationState::animationsChanged() {
 void AnimationState::computeHold(TrackEntry *entry) {
 	TrackEntry *to = entry->_mixingTo;
 	Vector<Timeline *> &timelines = entry->_animation->_timelines;
+	Vector<unsigned char> &timelineKinds = entry->_animation->_timelineKinds;
 	size_t timelinesCount = timelines.size();
 	Vector<int> &timelineMode = entry->_timelineMode;
 	timelineMode.setSize(timelinesCount, 0);
@@ -1024,7 +1202,7 @@ void AnimationState::computeHold(TrackEntry *entry) {
 
 	if (to != NULL && to->_holdPrevious) {
 		for (size_t i = 0; i < timelinesCount; i++) {
-			timelineMode[i] = _propertyIDs.addAll(timelines[i]->getPropertyIds(), true) ? HoldFirst : HoldSubsequent;
+			timelineMode[i] = addProperties(timelines[i]) ? HoldFirst : HoldSubsequent;
 		}
 		return;
 	}
@@ -1034,17 +1212,16 @@ void AnimationState::computeHold(TrackEntry *entry) {
 continue_outer:
 	for (; i < timelinesCount; ++i) {
 		Timeline *timeline = timelines[i];
-		Vector<PropertyId> &ids = timeline->getPropertyIds();
-		if (!_propertyIDs.addAll(ids, true)) {
+		if (!addProperties(timeline)) {
 			timelineMode[i] = Subsequent;
 		} else {
-			if (to == NULL || timeline->getRTTI().isExactly(AttachmentTimeline::rtti) ||
-				timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) ||
-				timeline->getRTTI().isExactly(EventTimeline::rtti) || !to->_animation->hasTimeline(ids)) {
+			int kind = timelineKinds[i];
+			if (to == NULL || kind == TimelineKind_Attachment || kind == TimelineKind_DrawOrder ||
+				kind == TimelineKind_Event || !hasProperties(to->_animation, timeline)) {
 				timelineMode[i] = First;
 			} else {
 				for (TrackEntry *next = to->_mixingTo; next != NULL; next = next->_mixingTo) {
-					if (next->_animation->hasTimeline(ids)) continue;
+					if (hasProperties(next->_animation, timeline)) continue;
 					if (next->_mixDuration > 0) {
 						timelineMode[i] = HoldMix;
 						timelineHoldMix[i] = next;
@@ -1058,3 +1235,25 @@ continue_outer:
 		}
 	}
 }
+
+bool AnimationState::addProperties(Timeline *timeline) {
+	if (!_propertyIndexOwner) return _propertyIDs.addAll(timeline->getPropertyIds(), true);
+
+	bool added = false;
+	Vector<int> &indices = timeline->getPropertyIndices();
+	for (size_t i = 0, n = indices.size(); i < n; i++) {
+		uint32_t &bits = _propertyBits[indices[i] >> 5];
+		uint32_t bit = 1u << (indices[i] & 31);
+		if (!(bits & bit)) {
+			bits |= bit;
+			added = true;
+		}
+	}
+	return added;
+}
+
+bool AnimationState::hasProperties(Animation *animation, Timeline *timeline) {
+	if (!_propertyIndexOwner) return animation->hasTimeline(timeline->getPropertyIds());
+	if (animation->_timelines.size() == 0) return false;
+	return animation->hasProperty(timeline->getPropertyIndices());
+}
@@ -56,9 +56,37 @@ float AnimationStateData::getMix(Animation *from, Animation *to) {
 	assert(to != NULL);
 
 	AnimationPair key(from, to);
+	return _animationToMixTime.get(key, _defaultMix);
+}
 
-	if (_animationToMixTime.containsKey(key)) return _animationToMixTime[key];
-	return _defaultMix;
+void AnimationStateData::setMixes(Vector<Animation *> &animations, Vector<float> &durations) {
+	size_t n = animations.size();
+	assert(durations.size() == n * n);
+	for (size_t i = 0; i < n; i++)
+		assert(animations[i] != NULL);
+
+	size_t count = 0;
+	for (size_t i = 0, nn = n * n; i < nn; i++)
+		if (durations[i] >= 0) count++;
+	_animationToMixTime.ensureCapacity(_animationToMixTime.size() + count);
+
+	for (size_t from = 0; from < n; from++) {
+		float *row = durations.buffer() + from * n;
+		for (size_t to = 0; to < n; to++) {
+			if (row[to] < 0) continue;
+			setMix(animations[from], animations[to], row[to]);
+		}
+	}
+}
+
+void AnimationStateData::setMixes(Vector<String> &animationNames, Vector<float> &durations) {
+	Vector<Animation *> animations;
+	animations.setSize(animationNames.size(), NULL);
+	for (size_t i = 0, n = animationNames.size(); i < n; i++) {
+		animations[i] = _skeletonData->findAnimation(animationNames[i]);
+		assert(animations[i] != NULL);
+	}
+	setMixes(animations, durations);
 }
 
 SkeletonData *AnimationStateData::getSkeletonData() {
@@ -82,5 +110,9 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 }
 
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
-	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
+	return _a1 == other._a1 && _a2 == other._a2;
+}
+
+size_t AnimationStateData::AnimationPair::hashCode() const {
+	return HashCode<Animation *>::hash(_a1) * 31 + HashCode<Animation *>::hash(_a2);
 }
@@ -0,0 +1,217 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/BakedAnimation.h>
+
+#include <spine/Animation.h>
+#include <spine/Extension.h>
+#include <spine/MathUtil.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/SimdUtil.h>
+#include <spine/TranslateTimeline.h>
+
+#include <assert.h>
+#include <math.h>
+
+using namespace spine;
+
+/// The number of channels of a bone timeline, or 0 for other timelines.
+static int getChannels(Timeline *timeline) {
+	const RTTI &rtti = timeline->getRTTI();
+	if (rtti.isExactly(RotateTimeline::rtti) || rtti.isExactly(TranslateXTimeline::rtti) ||
+		rtti.isExactly(TranslateYTimeline::rtti) || rtti.isExactly(ScaleXTimeline::rtti) ||
+		rtti.isExactly(ScaleYTimeline::rtti) || rtti.isExactly(ShearXTimeline::rtti) ||
+		rtti.isExactly(ShearYTimeline::rtti))
+		return 1;
+	if (rtti.isExactly(TranslateTimeline::rtti) || rtti.isExactly(ScaleTimeline::rtti) ||
+		rtti.isExactly(ShearTimeline::rtti))
+		return 2;
+	return 0;
+}
+
+/// Evaluates the curves of a bone timeline, which must not be baked yet. Before the first key the timelines are not
+/// applied, so the value of the first key is used.
+static void getCurveValues(CurveTimeline *timeline, int channels, float time, float *values) {
+	time = MathUtil::max(time, timeline->getFrames()[0]);
+	if (channels == 1)
+		values[0] = static_cast<CurveTimeline1 *>(timeline)->getCurveValue(time);
+	else
+		static_cast<CurveTimeline2 *>(timeline)->getCurveValues(time, values[0], values[1]);
+}
+
+BakedAnimation::BakedAnimation(Animation &animation, float fps, float maxError) : _animation(animation),
+																				  _fps(fps),
+																				  _channelCount(0),
+																				  _stride(0),
+																				  _frameCount(0),
+																				  _frames(NULL) {
+	assert(fps > 0);
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	float end = animation.getDuration();
+	for (size_t i = 0; i < timelines.size(); i++)
+		if (getChannels(timelines[i])) end = MathUtil::max(end, timelines[i]->getDuration());
+	_frameCount = (size_t) ceilf(end * fps) + 1;
+
+	// Sample each timeline at the frames, then measure how far the lerp between them is from the curves halfway
+	// between frames, a quarter of the way and at the keys, where the curves turn.
+	Vector<float> samples;
+	Vector<int> timelineChannels;
+	float exact[2];
+	for (size_t i = 0; i < timelines.size(); i++) {
+		int channels = getChannels(timelines[i]);
+		if (!channels) continue;
+		CurveTimeline *timeline = static_cast<CurveTimeline *>(timelines[i]);
+		size_t offset = samples.size();
+		samples.setSize(offset + _frameCount * channels, 0);
+		float *column = samples.buffer() + offset;
+		for (size_t frame = 0; frame < _frameCount; frame++)
+			getCurveValues(timeline, channels, frame / fps, column + frame * channels);
+
+		float errors[2] = {0, 0};
+		Vector<float> &keys = timeline->getFrames();
+		size_t keyEntries = keys.size() / timeline->getFrameCount(), subframes = _frameCount * 4;
+		float first = keys[0];
+		for (size_t frame = 0, n = subframes + timeline->getFrameCount(); frame < n; frame++) {
+			float time = frame < subframes ? frame / (fps * 4) : keys[(frame - subframes) * keyEntries];
+			if (time < first || time > end) continue;
+			float position = time * fps;
+			size_t index = MathUtil::min((size_t) position, _frameCount - 1);
+			size_t next = MathUtil::min(index + 1, _frameCount - 1);
+			float alpha = position - index;
+			getCurveValues(timeline, channels, time, exact);
+			for (int ii = 0; ii < channels; ii++) {
+				float from = column[index * channels + ii], to = column[next * channels + ii];
+				errors[ii] = MathUtil::max(errors[ii], MathUtil::abs(from + (to - from) * alpha - exact[ii]));
+			}
+		}
+		if (errors[0] > maxError || errors[1] > maxError) {
+			samples.setSize(offset, 0);
+			continue;
+		}
+		_timelines.add(timeline);
+		timelineChannels.add(channels);
+		for (int ii = 0; ii < channels; ii++)
+			_errors.add(errors[ii]);
+		_channelCount += channels;
+	}
+
+	_stride = (_channelCount + 7) & ~(size_t) 7;
+	if (!_channelCount) return;
+	_frames = SpineExtension::calloc<float>(_frameCount * _stride, __FILE__, __LINE__);
+	const float *column = samples.buffer();
+	for (size_t i = 0, channel = 0; i < _timelines.size(); i++) {
+		int channels = timelineChannels[i];
+		_timelines[i]->_bakedChannel = (int) channel;
+		for (size_t frame = 0; frame < _frameCount; frame++)
+			for (int ii = 0; ii < channels; ii++)
+				_frames[frame * _stride + channel + ii] = column[frame * channels + ii];
+		column += _frameCount * channels;
+		channel += channels;
+	}
+}
+
+BakedAnimation::~BakedAnimation() {
+	for (size_t i = 0; i < _timelines.size(); i++)
+		_timelines[i]->_bakedChannel = -1;
+	if (_frames) SpineExtension::free(_frames, __FILE__, __LINE__);
+}
+
+void BakedAnimation::sample(float time, float *values) {
+	if (!_channelCount) return;
+	float position = time * _fps, alpha = 0;
+	size_t index = 0;
+	if (position > 0) {
+		index = (size_t) position;
+		if (index >= _frameCount - 1)
+			index = _frameCount - 1;
+		else
+			alpha = position - index;
+	}
+	const float *from = _frames + index * _stride;
+	const float *to = index + 1 < _frameCount ? from + _stride : from;
+	size_t i = 0;
+#ifdef SPINE_SIMD_WIDTH
+	const int W = SPINE_SIMD_WIDTH;
+	SimdFloat a = simdSet(alpha);
+	for (; i + W <= _stride; i += W) {
+		SimdFloat v = simdLoad(from + i);
+		simdStore(values + i, simdAdd(v, simdMul(simdSub(simdLoad(to + i), v), a)));
+	}
+#endif
+	for (; i < _channelCount; i++)
+		values[i] = from[i] + (to[i] - from[i]) * alpha;
+}
+
+Animation &BakedAnimation::getAnimation() {
+	return _animation;
+}
+
+float BakedAnimation::getFps() {
+	return _fps;
+}
+
+size_t BakedAnimation::getChannelCount() {
+	return _channelCount;
+}
+
+size_t BakedAnimation::getStride() {
+	return _stride;
+}
+
+size_t BakedAnimation::getFrameCount() {
+	return _frameCount;
+}
+
+size_t BakedAnimation::getTimelineCount() {
+	return _timelines.size();
+}
+
+float BakedAnimation::getMaxError() {
+	float error = 0;
+	for (size_t i = 0; i < _errors.size(); i++)
+		error = MathUtil::max(error, _errors[i]);
+	return error;
+}
+
+float BakedAnimation::getMaxError(size_t channel) {
+	return _errors[channel];
+}
+
+size_t BakedAnimation::getMemorySize() {
+	return _frameCount * _stride * sizeof(float);
+}
+
+size_t BakedAnimation::getCurveMemorySize() {
+	size_t size = 0;
+	for (size_t i = 0; i < _timelines.size(); i++)
+		size += _timelines[i]->getMemorySize();
+	return size;
+}
@@ -0,0 +1,344 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/BatchedTimelines.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/HashMap.h>
+#include <spine/MathUtil.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonPose.h>
+#include <spine/TranslateTimeline.h>
+
+using namespace spine;
+
+/// The number of values gathered before they are blended, small enough for the scratch arrays to stay on the stack.
+static const size_t BatchSize = 64;
+
+/// How the values of a group are blended into the pose.
+enum GroupBlend {
+	GroupBlend_Rotate,
+	GroupBlend_Offset,
+	GroupBlend_Scale
+};
+
+/// Before the first key, resets the pose to the setup pose like the bone timelines do for MixBlend_Setup and
+/// MixBlend_First.
+static void blendSetup(float *pose, const int *bones, const float *setups, size_t count, float alpha, MixBlend blend) {
+	if (blend == MixBlend_Setup) {
+		for (size_t i = 0; i < count; i++)
+			pose[bones[i]] = setups[i];
+	} else {
+		for (size_t i = 0; i < count; i++) {
+			float &value = pose[bones[i]];
+			value += (setups[i] - value) * alpha;
+		}
+	}
+}
+
+/// Blends like RotateTimeline::apply().
+static void blendRotations(float *pose, const int *bones, const float *setups, const float *values, size_t count,
+						   float alpha, MixBlend blend) {
+	switch (blend) {
+		case MixBlend_Setup:
+			for (size_t i = 0; i < count; i++)
+				pose[bones[i]] = setups[i] + values[i] * alpha;
+			break;
+		case MixBlend_First:
+		case MixBlend_Replace:
+			for (size_t i = 0; i < count; i++) {
+				float &value = pose[bones[i]];
+				value += (values[i] + (setups[i] - value)) * alpha;
+			}
+			break;
+		case MixBlend_Add:
+			for (size_t i = 0; i < count; i++)
+				pose[bones[i]] += values[i] * alpha;
+	}
+}
+
+/// Blends like TranslateTimeline::apply() and ShearTimeline::apply().
+static void blendOffsets(float *pose, const int *bones, const float *setups, const float *values, size_t count,
+						 float alpha, MixBlend blend) {
+	switch (blend) {
+		case MixBlend_Setup:
+			for (size_t i = 0; i < count; i++)
+				pose[bones[i]] = setups[i] + values[i] * alpha;
+			break;
+		case MixBlend_First:
+		case MixBlend_Replace:
+			for (size_t i = 0; i < count; i++) {
+				float &value = pose[bones[i]];
+				value += (setups[i] + values[i] - value) * alpha;
+			}
+			break;
+		case MixBlend_Add:
+			for (size_t i = 0; i < count; i++)
+				pose[bones[i]] += values[i] * alpha;
+	}
+}
+
+/// Blends like ScaleTimeline::apply(). The values are multiplied by the setup scales.
+static void blendScales(float *pose, const int *bones, const float *setups, const float *values, size_t count,
+						float alpha, MixBlend blend, MixDirection direction) {
+	if (alpha == 1) {
+		if (blend == MixBlend_Add) {
+			for (size_t i = 0; i < count; i++)
+				pose[bones[i]] += values[i] * setups[i] - setups[i];
+		} else {
+			for (size_t i = 0; i < count; i++)
+				pose[bones[i]] = values[i] * setups[i];
+		}
+		return;
+	}
+	if (blend == MixBlend_Add) {
+		for (size_t i = 0; i < count; i++)
+			pose[bones[i]] += (values[i] * setups[i] - setups[i]) * alpha;
+		return;
+	}
+	// Mixing out uses sign of setup or current pose, else use sign of key.
+	bool setup = blend == MixBlend_Setup;
+	if (direction == MixDirection_Out) {
+		for (size_t i = 0; i < count; i++) {
+			float &value = pose[bones[i]];
+			float x = values[i] * setups[i], bx = setup ? setups[i] : value;
+			value = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+		}
+	} else {
+		for (size_t i = 0; i < count; i++) {
+			float &value = pose[bones[i]];
+			float x = values[i] * setups[i], bx = MathUtil::abs(setup ? setups[i] : value) * MathUtil::sign(x);
+			value = bx + (x - bx) * alpha;
+		}
+	}
+}
+
+static void blendValues(GroupBlend groupBlend, float *pose, const int *bones, const float *setups, const float *values,
+						size_t count, float alpha, MixBlend blend, MixDirection direction) {
+	switch (groupBlend) {
+		case GroupBlend_Rotate:
+			blendRotations(pose, bones, setups, values, count, alpha, blend);
+			break;
+		case GroupBlend_Offset:
+			blendOffsets(pose, bones, setups, values, count, alpha, blend);
+			break;
+		case GroupBlend_Scale:
+			blendScales(pose, bones, setups, values, count, alpha, blend, direction);
+	}
+}
+
+BatchedTimelines::BatchedTimelines(Animation &animation) : _animation(animation) {
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	size_t timelineCount = timelines.size();
+
+	// A property keyed by several timelines must be set in the order of the timelines.
+	HashMap<PropertyId, int> keyCounts;
+	for (size_t i = 0; i < timelineCount; i++) {
+		Vector<PropertyId> &ids = timelines[i]->getPropertyIds();
+		for (size_t ii = 0; ii < ids.size(); ii++)
+			keyCounts.put(ids[ii], keyCounts.get(ids[ii], 0) + 1);
+	}
+
+	Vector<int> groups;
+	groups.setSize(timelineCount, Group_Count);
+	for (size_t i = 0; i < timelineCount; i++) {
+		Timeline *timeline = timelines[i];
+		Vector<PropertyId> &ids = timeline->getPropertyIds();
+		bool shared = false;
+		for (size_t ii = 0; ii < ids.size(); ii++)
+			if (keyCounts.get(ids[ii], 0) > 1) shared = true;
+		if (shared) continue;
+
+		const RTTI &rtti = timeline->getRTTI();
+		if (rtti.isExactly(RotateTimeline::rtti)) groups[i] = Group_Rotate;
+		else if (rtti.isExactly(TranslateXTimeline::rtti)) groups[i] = Group_TranslateX;
+		else if (rtti.isExactly(TranslateYTimeline::rtti)) groups[i] = Group_TranslateY;
+		else if (rtti.isExactly(TranslateTimeline::rtti)) groups[i] = Group_Translate;
+		else if (rtti.isExactly(ScaleXTimeline::rtti)) groups[i] = Group_ScaleX;
+		else if (rtti.isExactly(ScaleYTimeline::rtti)) groups[i] = Group_ScaleY;
+		else if (rtti.isExactly(ScaleTimeline::rtti)) groups[i] = Group_Scale;
+		else if (rtti.isExactly(ShearXTimeline::rtti)) groups[i] = Group_ShearX;
+		else if (rtti.isExactly(ShearYTimeline::rtti)) groups[i] = Group_ShearY;
+		else if (rtti.isExactly(ShearTimeline::rtti)) groups[i] = Group_Shear;
+	}
+
+	_grouped.setSize(timelineCount, false);
+	for (int group = 0; group < Group_Count; group++) {
+		_groupOffsets[group] = _timelines.size();
+		for (size_t i = 0; i < timelineCount; i++) {
+			if (groups[i] != group) continue;
+			// The bone timelines store their bone index in the low bits of their first property id.
+			_timelines.add(static_cast<CurveTimeline *>(timelines[i]));
+			_bones.add((int) (timelines[i]->getPropertyIds()[0] & 0xffffffff));
+			_indices.add((int) i);
+			_grouped[i] = true;
+		}
+	}
+	_groupOffsets[Group_Count] = _timelines.size();
+}
+
+BatchedTimelines::~BatchedTimelines() {
+}
+
+void BatchedTimelines::apply(Skeleton &skeleton, float time, float alpha, MixBlend blend, MixDirection direction,
+							 int *cursors, const bool *skip) {
+	const float *baked = Animation::getBakedValues();
+	SkeletonPose &pose = skeleton.getPose();
+	Bone **bones = skeleton.getBones().buffer();
+	for (int group = 0; group < Group_Count; group++) {
+		if (_groupOffsets[group] == _groupOffsets[group + 1]) continue;
+		applyGroup(pose, bones, (Group) group, time, alpha, blend, direction, cursors, skip, baked);
+	}
+}
+
+void BatchedTimelines::applyGroup(SkeletonPose &pose, Bone **bones, Group group, float time, float alpha,
+								  MixBlend blend, MixDirection direction, int *cursors, const bool *skip,
+								  const float *baked) {
+	size_t start = _groupOffsets[group], end = _groupOffsets[group + 1];
+
+	GroupBlend groupBlend = GroupBlend_Offset;
+	PoseComponent component1 = PoseComponent_X, component2 = PoseComponent_Y;
+	float BoneData::*setup1 = &BoneData::_x;
+	float BoneData::*setup2 = &BoneData::_y;
+	bool values2 = false;
+	switch (group) {
+		case Group_Rotate:
+			groupBlend = GroupBlend_Rotate;
+			component1 = PoseComponent_Rotation;
+			setup1 = &BoneData::_rotation;
+			break;
+		case Group_TranslateX:
+			break;
+		case Group_TranslateY:
+			component1 = PoseComponent_Y;
+			setup1 = &BoneData::_y;
+			break;
+		case Group_Translate:
+			values2 = true;
+			break;
+		case Group_ScaleX:
+		case Group_ScaleY:
+		case Group_Scale:
+			groupBlend = GroupBlend_Scale;
+			component1 = group == Group_ScaleY ? PoseComponent_ScaleY : PoseComponent_ScaleX;
+			component2 = PoseComponent_ScaleY;
+			setup1 = group == Group_ScaleY ? &BoneData::_scaleY : &BoneData::_scaleX;
+			setup2 = &BoneData::_scaleY;
+			values2 = group == Group_Scale;
+			break;
+		case Group_ShearX:
+		case Group_ShearY:
+		case Group_Shear:
+			component1 = group == Group_ShearY ? PoseComponent_ShearY : PoseComponent_ShearX;
+			component2 = PoseComponent_ShearY;
+			setup1 = group == Group_ShearY ? &BoneData::_shearY : &BoneData::_shearX;
+			setup2 = &BoneData::_shearY;
+			values2 = group == Group_Shear;
+			break;
+		default:
+			return;
+	}
+
+	float *pose1 = pose.getComponent(component1), *pose2 = pose.getComponent(component2);
+	bool resetBefore = blend == MixBlend_Setup || blend == MixBlend_First;
+
+	// The bones keyed after the first key with their values, and the bones before the first key which are reset.
+	int valueBones[BatchSize], resetBones[BatchSize];
+	float values[2][BatchSize], valueSetups[2][BatchSize], resetSetups[2][BatchSize];
+	size_t valueCount = 0, resetCount = 0;
+	CurveTimeline **timelines = _timelines.buffer();
+	int *timelineBones = _bones.buffer(), *indices = _indices.buffer();
+	for (size_t i = start; i <= end; i++) {
+		if (i < end) {
+			int index = indices[i];
+			if (skip && skip[index]) continue;
+			int boneIndex = timelineBones[i];
+			Bone *bone = bones[boneIndex];
+			if (!bone->_active) continue;
+			BoneData &data = bone->_data;
+
+			CurveTimeline *timeline = timelines[i];
+			if (time < timeline->_frames[0]) {
+				if (!resetBefore) continue;
+				resetBones[resetCount] = boneIndex;
+				resetSetups[0][resetCount] = data.*setup1;
+				if (values2) resetSetups[1][resetCount] = data.*setup2;
+				if (++resetCount < BatchSize) continue;
+			} else {
+				if (baked && timeline->_bakedChannel != -1) {
+					// Baked values need no search or curve.
+					values[0][valueCount] = baked[timeline->_bakedChannel];
+					if (values2) values[1][valueCount] = baked[timeline->_bakedChannel + 1];
+				} else {
+					if (cursors) Animation::setSearchCursor(cursors + index);
+					if (values2)
+						static_cast<CurveTimeline2 *>(timeline)->getCurveValues(time, values[0][valueCount],
+																				values[1][valueCount]);
+					else
+						values[0][valueCount] = static_cast<CurveTimeline1 *>(timeline)->getCurveValue(time);
+				}
+				valueBones[valueCount] = boneIndex;
+				valueSetups[0][valueCount] = data.*setup1;
+				if (values2) valueSetups[1][valueCount] = data.*setup2;
+				if (++valueCount < BatchSize) continue;
+			}
+		}
+
+		// Blend when a batch is full and at the end.
+		if (resetCount == BatchSize || (i == end && resetCount)) {
+			blendSetup(pose1, resetBones, resetSetups[0], resetCount, alpha, blend);
+			if (values2) blendSetup(pose2, resetBones, resetSetups[1], resetCount, alpha, blend);
+			resetCount = 0;
+		}
+		if (valueCount == BatchSize || (i == end && valueCount)) {
+			blendValues(groupBlend, pose1, valueBones, valueSetups[0], values[0], valueCount, alpha, blend, direction);
+			if (values2)
+				blendValues(groupBlend, pose2, valueBones, valueSetups[1], values[1], valueCount, alpha, blend,
+							direction);
+			valueCount = 0;
+		}
+	}
+}
+
+Animation &BatchedTimelines::getAnimation() {
+	return _animation;
+}
+
+Vector<bool> &BatchedTimelines::getGrouped() {
+	return _grouped;
+}
+
+size_t BatchedTimelines::getTimelineCount() {
+	return _timelines.size();
+}
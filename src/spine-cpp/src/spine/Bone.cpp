@@ -50,37 +50,26 @@ Bone::Bone(BoneData &data, Skeleton &skeleton, Bone *parent) : Updatable(),
 															   _data(data),
 															   _skeleton(skeleton),
 															   _parent(parent),
-															   _x(0),
-															   _y(0),
-															   _rotation(0),
-															   _scaleX(0),
-															   _scaleY(0),
-															   _shearX(0),
-															   _shearY(0),
-															   _ax(0),
-															   _ay(0),
-															   _arotation(0),
-															   _ascaleX(0),
-															   _ascaleY(0),
-															   _ashearX(0),
-															   _ashearY(0),
-															   _a(1),
-															   _b(0),
-															   _worldX(0),
-															   _c(0),
-															   _d(1),
-															   _worldY(0),
+															   _pose(skeleton.getPose()),
+															   _index(data.getIndex()),
 															   _sorted(false),
 															   _active(false) {
+	assert(_index < (int) _pose.getBoneCount());
+	_a() = 1;
+	_b() = 0;
+	_worldX() = 0;
+	_c() = 0;
+	_d() = 1;
+	_worldY() = 0;
 	setToSetupPose();
 }
 
 void Bone::update() {
-	updateWorldTransform(_ax, _ay, _arotation, _ascaleX, _ascaleY, _ashearX, _ashearY);
+	updateWorldTransform(_ax(), _ay(), _arotation(), _ascaleX(), _ascaleY(), _ashearX(), _ashearY());
 }
 
 void Bone::updateWorldTransform() {
-	updateWorldTransform(_x, _y, _rotation, _scaleX, _scaleY, _shearX, _shearY);
+	updateWorldTransform(_x(), _y(), _rotation(), _scaleX(), _scaleY(), _shearX(), _shearY());
 }
 
 void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX, float scaleY, float shearX, float shearY) {
@@ -88,54 +77,60 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 	float pa, pb, pc, pd;
 	Bone *parent = _parent;
 
-	_ax = x;
-	_ay = y;
-	_arotation = rotation;
-	_ascaleX = scaleX;
-	_ascaleY = scaleY;
-	_ashearX = shearX;
-	_ashearY = shearY;
+	_ax() = x;
+	_ay() = y;
+	_arotation() = rotation;
+	_ascaleX() = scaleX;
+	_ascaleY() = scaleY;
+	_ashearX() = shearX;
+	_ashearY() = shearY;
 
 	if (!parent) { /* Root bone. */
-		float rotationY = rotation + 90 + shearY;
+		float sinX, cosX, sinY, cosY;
+		MathUtil::sinCosDeg(rotation + shearX, sinX, cosX);
+		MathUtil::sinCosDeg(rotation + 90 + shearY, sinY, cosY);
 		float sx = _skeleton.getScaleX();
 		float sy = _skeleton.getScaleY();
-		_a = MathUtil::cosDeg(rotation + shearX) * scaleX * sx;
-		_b = MathUtil::cosDeg(rotationY) * scaleY * sx;
-		_c = MathUtil::sinDeg(rotation + shearX) * scaleX * sy;
-		_d = MathUtil::sinDeg(rotationY) * scaleY * sy;
-		_worldX = x * sx + _skeleton.getX();
-		_worldY = y * sy + _skeleton.getY();
+		_a() = cosX * scaleX * sx;
+		_b() = cosY * scaleY * sx;
+		_c() = sinX * scaleX * sy;
+		_d() = sinY * scaleY * sy;
+		_worldX() = x * sx + _skeleton.getX();
+		_worldY() = y * sy + _skeleton.getY();
 		return;
 	}
 
-	pa = parent->_a;
-	pb = parent->_b;
-	pc = parent->_c;
-	pd = parent->_d;
+	pa = parent->_a();
+	pb = parent->_b();
+	pc = parent->_c();
+	pd = parent->_d();
 
-	_worldX = pa * x + pb * y + parent->_worldX;
-	_worldY = pc * x + pd * y + parent->_worldY;
+	_worldX() = pa * x + pb * y + parent->_worldX();
+	_worldY() = pc * x + pd * y + parent->_worldY();
 
 	switch (_data.getTransformMode()) {
 		case TransformMode_Normal: {
-			float rotationY = rotation + 90 + shearY;
-			float la = MathUtil::cosDeg(rotation + shearX) * scaleX;
-			float lb = MathUtil::cosDeg(rotationY) * scaleY;
-			float lc = MathUtil::sinDeg(rotation + shearX) * scaleX;
-			float ld = MathUtil::sinDeg(rotationY) * scaleY;
-			_a = pa * la + pb * lc;
-			_b = pa * lb + pb * ld;
-			_c = pc * la + pd * lc;
-			_d = pc * lb + pd * ld;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCosDeg(rotation + shearX, sinX, cosX);
+			MathUtil::sinCosDeg(rotation + 90 + shearY, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
+			_a() = pa * la + pb * lc;
+			_b() = pa * lb + pb * ld;
+			_c() = pc * la + pd * lc;
+			_d() = pc * lb + pd * ld;
 			return;
 		}
 		case TransformMode_OnlyTranslation: {
-			float rotationY = rotation + 90 + shearY;
-			_a = MathUtil::cosDeg(rotation + shearX) * scaleX;
-			_b = MathUtil::cosDeg(rotationY) * scaleY;
-			_c = MathUtil::sinDeg(rotation + shearX) * scaleX;
-			_d = MathUtil::sinDeg(rotationY) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCosDeg(rotation + shearX, sinX, cosX);
+			MathUtil::sinCosDeg(rotation + 90 + shearY, sinY, cosY);
+			_a() = cosX * scaleX;
+			_b() = cosY * scaleY;
+			_c() = sinX * scaleX;
+			_d() = sinY * scaleY;
 			break;
 		}
 		case TransformMode_NoRotationOrReflection: {
@@ -155,22 +150,24 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			}
 			rx = rotation + shearX - prx;
 			ry = rotation + shearY - prx + 90;
-			la = MathUtil::cosDeg(rx) * scaleX;
-			lb = MathUtil::cosDeg(ry) * scaleY;
-			lc = MathUtil::sinDeg(rx) * scaleX;
-			ld = MathUtil::sinDeg(ry) * scaleY;
-			_a = pa * la - pb * lc;
-			_b = pa * lb - pb * ld;
-			_c = pc * la + pd * lc;
-			_d = pc * lb + pd * ld;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCosDeg(rx, sinX, cosX);
+			MathUtil::sinCosDeg(ry, sinY, cosY);
+			la = cosX * scaleX;
+			lb = cosY * scaleY;
+			lc = sinX * scaleX;
+			ld = sinY * scaleY;
+			_a() = pa * la - pb * lc;
+			_b() = pa * lb - pb * ld;
+			_c() = pc * la + pd * lc;
+			_d() = pc * lb + pd * ld;
 			break;
 		}
 		case TransformMode_NoScale:
 		case TransformMode_NoScaleOrReflection: {
 			float za, zc, s;
 			float r, zb, zd, la, lb, lc, ld;
-			cosine = MathUtil::cosDeg(rotation);
-			sine = MathUtil::sinDeg(rotation);
+			MathUtil::sinCosDeg(rotation, sine, cosine);
 			za = (pa * cosine + pb * sine) / _skeleton.getScaleX();
 			zc = (pc * cosine + pd * sine) / _skeleton.getScaleY();
 			s = MathUtil::sqrt(za * za + zc * zc);
@@ -184,96 +181,99 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			r = MathUtil::Pi / 2 + MathUtil::atan2(zc, za);
 			zb = MathUtil::cos(r) * s;
 			zd = MathUtil::sin(r) * s;
-			la = MathUtil::cosDeg(shearX) * scaleX;
-			lb = MathUtil::cosDeg(90 + shearY) * scaleY;
-			lc = MathUtil::sinDeg(shearX) * scaleX;
-			ld = MathUtil::sinDeg(90 + shearY) * scaleY;
-			_a = za * la + zb * lc;
-			_b = za * lb + zb * ld;
-			_c = zc * la + zd * lc;
-			_d = zc * lb + zd * ld;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCosDeg(shearX, sinX, cosX);
+			MathUtil::sinCosDeg(90 + shearY, sinY, cosY);
+			la = cosX * scaleX;
+			lb = cosY * scaleY;
+			lc = sinX * scaleX;
+			ld = sinY * scaleY;
+			_a() = za * la + zb * lc;
+			_b() = za * lb + zb * ld;
+			_c() = zc * la + zd * lc;
+			_d() = zc * lb + zd * ld;
 			break;
 		}
 	}
-	_a *= _skeleton.getScaleX();
-	_b *= _skeleton.getScaleX();
-	_c *= _skeleton.getScaleY();
-	_d *= _skeleton.getScaleY();
+	_a() *= _skeleton.getScaleX();
+	_b() *= _skeleton.getScaleX();
+	_c() *= _skeleton.getScaleY();
+	_d() *= _skeleton.getScaleY();
 }
 
 void Bone::setToSetupPose() {
 	BoneData &data = _data;
-	_x = data.getX();
-	_y = data.getY();
-	_rotation = data.getRotation();
-	_scaleX = data.getScaleX();
-	_scaleY = data.getScaleY();
-	_shearX = data.getShearX();
-	_shearY = data.getShearY();
+	_x() = data.getX();
+	_y() = data.getY();
+	_rotation() = data.getRotation();
+	_scaleX() = data.getScaleX();
+	_scaleY() = data.getScaleY();
+	_shearX() = data.getShearX();
+	_shearY() = data.getShearY();
 }
 
 void Bone::worldToLocal(float worldX, float worldY, float &outLocalX, float &outLocalY) {
-	float a = _a;
-	float b = _b;
-	float c = _c;
-	float d = _d;
+	float a = _a();
+	float b = _b();
+	float c = _c();
+	float d = _d();
 
 	float invDet = 1 / (a * d - b * c);
-	float x = worldX - _worldX;
-	float y = worldY - _worldY;
+	float x = worldX - _worldX();
+	float y = worldY - _worldY();
 
 	outLocalX = (x * d * invDet - y * b * invDet);
 	outLocalY = (y * a * invDet - x * c * invDet);
 }
 
 void Bone::localToWorld(float localX, float localY, float &outWorldX, float &outWorldY) {
-	outWorldX = localX * _a + localY * _b + _worldX;
-	outWorldY = localX * _c + localY * _d + _worldY;
+	outWorldX = localX * _a() + localY * _b() + _worldX();
+	outWorldY = localX * _c() + localY * _d() + _worldY();
 }
 
 float Bone::worldToLocalRotation(float worldRotation) {
 	float sin = MathUtil::sinDeg(worldRotation);
 	float cos = MathUtil::cosDeg(worldRotation);
 
-	return MathUtil::atan2(_a * sin - _c * cos, _d * cos - _b * sin) * MathUtil::Rad_Deg + this->_rotation -
-		   this->_shearX;
+	return MathUtil::atan2(_a() * sin - _c() * cos, _d() * cos - _b() * sin) * MathUtil::Rad_Deg + this->_rotation() -
+		   this->_shearX();
 }
 
 float Bone::localToWorldRotation(float localRotation) {
-	localRotation -= this->_rotation - this->_shearX;
+	localRotation -= this->_rotation() - this->_shearX();
 	float sin = MathUtil::sinDeg(localRotation);
 	float cos = MathUtil::cosDeg(localRotation);
 
-	return MathUtil::atan2(cos * _c + sin * _d, cos * _a + sin * _b) * MathUtil::Rad_Deg;
+	return MathUtil::atan2(cos * _c() + sin * _d(), cos * _a() + sin * _b()) * MathUtil::Rad_Deg;
 }
 
 void Bone::rotateWorld(float degrees) {
-	float a = _a;
-	float b = _b;
-	float c = _c;
-	float d = _d;
+	float a = _a();
+	float b = _b();
+	float c = _c();
+	float d = _d();
 
 	float cos = MathUtil::cosDeg(degrees);
 	float sin = MathUtil::sinDeg(degrees);
 
-	_a = cos * a - sin * c;
-	_b = cos * b - sin * d;
-	_c = sin * a + cos * c;
-	_d = sin * b + cos * d;
+	_a() = cos * a - sin * c;
+	_b() = cos * b - sin * d;
+	_c() = sin * a + cos * c;
+	_d() = sin * b + cos * d;
 }
 
 float Bone::getWorldToLocalRotationX() {
 	Bone *parent = _parent;
 	if (!parent) {
-		return _arotation;
+		return _arotation();
 	}
 
-	float pa = parent->_a;
-	float pb = parent->_b;
-	float pc = parent->_c;
-	float pd = parent->_d;
-	float a = _a;
-	float c = _c;
+	float pa = parent->_a();
+	float pb = parent->_b();
+	float pc = parent->_c();
+	float pd = parent->_d();
+	float a = _a();
+	float c = _c();
 
 	return MathUtil::atan2(pa * c - pc * a, pd * a - pb * c) * MathUtil::Rad_Deg;
 }
@@ -281,15 +281,15 @@ float Bone::getWorldToLocalRotationX() {
 float Bone::getWorldToLocalRotationY() {
 	Bone *parent = _parent;
 	if (!parent) {
-		return _arotation;
+		return _arotation();
 	}
 
-	float pa = parent->_a;
-	float pb = parent->_b;
-	float pc = parent->_c;
-	float pd = parent->_d;
-	float b = _b;
-	float d = _d;
+	float pa = parent->_a();
+	float pb = parent->_b();
+	float pc = parent->_c();
+	float pd = parent->_d();
+	float b = _b();
+	float d = _d();
 
 	return MathUtil::atan2(pa * d - pc * b, pd * b - pb * d) * MathUtil::Rad_Deg;
 }
@@ -311,217 +311,217 @@ Vector<Bone *> &Bone::getChildren() {
 }
 
 float Bone::getX() {
-	return _x;
+	return _x();
 }
 
 void Bone::setX(float inValue) {
-	_x = inValue;
+	_x() = inValue;
 }
 
 float Bone::getY() {
-	return _y;
+	return _y();
 }
 
 void Bone::setY(float inValue) {
-	_y = inValue;
+	_y() = inValue;
 }
 
 float Bone::getRotation() {
-	return _rotation;
+	return _rotation();
 }
 
 void Bone::setRotation(float inValue) {
-	_rotation = inValue;
+	_rotation() = inValue;
 }
 
 float Bone::getScaleX() {
-	return _scaleX;
+	return _scaleX();
 }
 
 void Bone::setScaleX(float inValue) {
-	_scaleX = inValue;
+	_scaleX() = inValue;
 }
 
 float Bone::getScaleY() {
-	return _scaleY;
+	return _scaleY();
 }
 
 void Bone::setScaleY(float inValue) {
-	_scaleY = inValue;
+	_scaleY() = inValue;
 }
 
 float Bone::getShearX() {
-	return _shearX;
+	return _shearX();
 }
 
 void Bone::setShearX(float inValue) {
-	_shearX = inValue;
+	_shearX() = inValue;
 }
 
 float Bone::getShearY() {
-	return _shearY;
+	return _shearY();
 }
 
 void Bone::setShearY(float inValue) {
-	_shearY = inValue;
+	_shearY() = inValue;
 }
 
 float Bone::getAppliedRotation() {
-	return _arotation;
+	return _arotation();
 }
 
 void Bone::setAppliedRotation(float inValue) {
-	_arotation = inValue;
+	_arotation() = inValue;
 }
 
 float Bone::getAX() {
-	return _ax;
+	return _ax();
 }
 
 void Bone::setAX(float inValue) {
-	_ax = inValue;
+	_ax() = inValue;
 }
 
 float Bone::getAY() {
-	return _ay;
+	return _ay();
 }
 
 void Bone::setAY(float inValue) {
-	_ay = inValue;
+	_ay() = inValue;
 }
 
 float Bone::getAScaleX() {
-	return _ascaleX;
+	return _ascaleX();
 }
 
 void Bone::setAScaleX(float inValue) {
-	_ascaleX = inValue;
+	_ascaleX() = inValue;
 }
 
 float Bone::getAScaleY() {
-	return _ascaleY;
+	return _ascaleY();
 }
 
 void Bone::setAScaleY(float inValue) {
-	_ascaleY = inValue;
+	_ascaleY() = inValue;
 }
 
 float Bone::getAShearX() {
-	return _ashearX;
+	return _ashearX();
 }
 
 void Bone::setAShearX(float inValue) {
-	_ashearX = inValue;
+	_ashearX() = inValue;
 }
 
 float Bone::getAShearY() {
-	return _ashearY;
+	return _ashearY();
 }
 
 void Bone::setAShearY(float inValue) {
-	_ashearY = inValue;
+	_ashearY() = inValue;
 }
 
 float Bone::getA() {
-	return _a;
+	return _a();
 }
 
 void Bone::setA(float inValue) {
-	_a = inValue;
+	_a() = inValue;
 }
 
 float Bone::getB() {
-	return _b;
+	return _b();
 }
 
 void Bone::setB(float inValue) {
-	_b = inValue;
+	_b() = inValue;
 }
 
 float Bone::getC() {
-	return _c;
+	return _c();
 }
 
 void Bone::setC(float inValue) {
-	_c = inValue;
+	_c() = inValue;
 }
 
 float Bone::getD() {
-	return _d;
+	return _d();
 }
 
 void Bone::setD(float inValue) {
-	_d = inValue;
+	_d() = inValue;
 }
 
 float Bone::getWorldX() {
-	return _worldX;
+	return _worldX();
 }
 
 void Bone::setWorldX(float inValue) {
-	_worldX = inValue;
+	_worldX() = inValue;
 }
 
 float Bone::getWorldY() {
-	return _worldY;
+	return _worldY();
 }
 
 void Bone::setWorldY(float inValue) {
-	_worldY = inValue;
+	_worldY() = inValue;
 }
 
 float Bone::getWorldRotationX() {
-	return MathUtil::atan2(_c, _a) * MathUtil::Rad_Deg;
+	return MathUtil::atan2(_c(), _a()) * MathUtil::Rad_Deg;
 }
 
 float Bone::getWorldRotationY() {
-	return MathUtil::atan2(_d, _b) * MathUtil::Rad_Deg;
+	return MathUtil::atan2(_d(), _b()) * MathUtil::Rad_Deg;
 }
 
 float Bone::getWorldScaleX() {
-	return MathUtil::sqrt(_a * _a + _c * _c);
+	return MathUtil::sqrt(_a() * _a() + _c() * _c());
 }
 
 float Bone::getWorldScaleY() {
-	return MathUtil::sqrt(_b * _b + _d * _d);
+	return MathUtil::sqrt(_b() * _b() + _d() * _d());
 }
 
 void Bone::updateAppliedTransform() {
 	Bone *parent = _parent;
 	if (!parent) {
-		_ax = _worldX - _skeleton.getX();
-		_ay = _worldY - _skeleton.getY();
-		_arotation = MathUtil::atan2(_c, _a) * MathUtil::Rad_Deg;
-		_ascaleX = MathUtil::sqrt(_a * _a + _c * _c);
-		_ascaleY = MathUtil::sqrt(_b * _b + _d * _d);
-		_ashearX = 0;
-		_ashearY = MathUtil::atan2(_a * _b + _c * _d, _a * _d - _b * _c) * MathUtil::Rad_Deg;
+		_ax() = _worldX() - _skeleton.getX();
+		_ay() = _worldY() - _skeleton.getY();
+		_arotation() = MathUtil::atan2(_c(), _a()) * MathUtil::Rad_Deg;
+		_ascaleX() = MathUtil::sqrt(_a() * _a() + _c() * _c());
+		_ascaleY() = MathUtil::sqrt(_b() * _b() + _d() * _d());
+		_ashearX() = 0;
+		_ashearY() = MathUtil::atan2(_a() * _b() + _c() * _d(), _a() * _d() - _b() * _c()) * MathUtil::Rad_Deg;
 	} else {
-		float pa = parent->_a, pb = parent->_b, pc = parent->_c, pd = parent->_d;
+		float pa = parent->_a(), pb = parent->_b(), pc = parent->_c(), pd = parent->_d();
 		float pid = 1 / (pa * pd - pb * pc);
-		float dx = _worldX - parent->_worldX, dy = _worldY - parent->_worldY;
+		float dx = _worldX() - parent->_worldX(), dy = _worldY() - parent->_worldY();
 		float ia = pid * pd;
 		float id = pid * pa;
 		float ib = pid * pb;
 		float ic = pid * pc;
-		float ra = ia * _a - ib * _c;
-		float rb = ia * _b - ib * _d;
-		float rc = id * _c - ic * _a;
-		float rd = id * _d - ic * _b;
-		_ax = (dx * pd * pid - dy * pb * pid);
-		_ay = (dy * pa * pid - dx * pc * pid);
-		_ashearX = 0;
-		_ascaleX = MathUtil::sqrt(ra * ra + rc * rc);
-		if (_ascaleX > 0.0001f) {
+		float ra = ia * _a() - ib * _c();
+		float rb = ia * _b() - ib * _d();
+		float rc = id * _c() - ic * _a();
+		float rd = id * _d() - ic * _b();
+		_ax() = (dx * pd * pid - dy * pb * pid);
+		_ay() = (dy * pa * pid - dx * pc * pid);
+		_ashearX() = 0;
+		_ascaleX() = MathUtil::sqrt(ra * ra + rc * rc);
+		if (_ascaleX() > 0.0001f) {
 			float det = ra * rd - rb * rc;
-			_ascaleY = det / _ascaleX;
-			_ashearY = MathUtil::atan2(ra * rb + rc * rd, det) * MathUtil::Rad_Deg;
-			_arotation = MathUtil::atan2(rc, ra) * MathUtil::Rad_Deg;
+			_ascaleY() = det / _ascaleX();
+			_ashearY() = MathUtil::atan2(ra * rb + rc * rd, det) * MathUtil::Rad_Deg;
+			_arotation() = MathUtil::atan2(rc, ra) * MathUtil::Rad_Deg;
 		} else {
-			_ascaleX = 0;
-			_ascaleY = MathUtil::sqrt(rb * rb + rd * rd);
-			_ashearY = 0;
-			_arotation = 90 - MathUtil::atan2(rd, rb) * MathUtil::Rad_Deg;
+			_ascaleX() = 0;
+			_ascaleY() = MathUtil::sqrt(rb * rb + rd * rd);
+			_ashearY() = 0;
+			_arotation() = 90 - MathUtil::atan2(rd, rb) * MathUtil::Rad_Deg;
 		}
 	}
 }
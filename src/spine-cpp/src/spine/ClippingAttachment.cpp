@@ -29,7 +29,10 @@
 
 #include <spine/ClippingAttachment.h>
 
+#include <spine/ContainerUtil.h>
+#include <spine/SkeletonClipping.h>
 #include <spine/SlotData.h>
+#include <spine/Triangulator.h>
 
 using namespace spine;
 
@@ -38,6 +41,10 @@ RTTI_IMPL(ClippingAttachment, VertexAttachment)
 ClippingAttachment::ClippingAttachment(const String &name) : VertexAttachment(name), _endSlot(NULL), _color() {
 }
 
+ClippingAttachment::~ClippingAttachment() {
+	ContainerUtil::cleanUpVectorOfPointers(_convexPolygons);
+}
+
 SlotData *ClippingAttachment::getEndSlot() {
 	return _endSlot;
 }
@@ -54,5 +61,23 @@ Attachment *ClippingAttachment::copy() {
 	ClippingAttachment *copy = new (__FILE__, __LINE__) ClippingAttachment(getName());
 	copyTo(copy);
 	copy->_endSlot = _endSlot;
+	for (size_t i = 0; i < _convexPolygons.size(); ++i)
+		copy->_convexPolygons.add(new (__FILE__, __LINE__) Vector<float>(*_convexPolygons[i]));
 	return copy;
 }
+
+void ClippingAttachment::updateConvexPolygons() {
+	ContainerUtil::cleanUpVectorOfPointers(_convexPolygons);
+	if (_bones.size() > 0 || _worldVerticesLength < 6) return;
+
+	Vector<float> polygon(_vertices);
+	SkeletonClipping::makeClockwise(polygon);
+	Triangulator triangulator;
+	Vector<Vector<float> *> &polygons = triangulator.decompose(polygon, triangulator.triangulate(polygon));
+	for (size_t i = 0; i < polygons.size(); ++i)
+		_convexPolygons.add(new (__FILE__, __LINE__) Vector<float>(*polygons[i]));
+}
+
+Vector<Vector<float> *> &ClippingAttachment::getConvexPolygons() {
+	return _convexPolygons;
+}
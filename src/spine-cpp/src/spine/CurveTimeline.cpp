@@ -29,14 +29,22 @@
 
 #include <spine/CurveTimeline.h>
 
+#include <spine/Animation.h>
 #include <spine/MathUtil.h>
 
+#include <assert.h>
+
 using namespace spine;
 
 RTTI_IMPL(CurveTimeline, Timeline)
 
 CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount,
-																									frameEntries) {
+																									frameEntries),
+																						   _bakedChannel(-1),
+																						   _quantizedBits(0),
+																						   _quantizedStride(0),
+																						   _quantizedCurveOffset(0),
+																						   _quantizedCurveScale(0) {
 	_curves.setSize(frameCount + bezierCount * BEZIER_SIZE, 0);
 	_curves[frameCount - 1] = STEPPED;
 }
@@ -94,6 +102,257 @@ Vector<float> &CurveTimeline::getCurves() {
 	return _curves;
 }
 
+static int quantize(float value, float offset, float scale, int levels) {
+	return (int) (MathUtil::clamp((value - offset) / scale, 0, (float) levels) + 0.5f);
+}
+
+static void setQuantized(Vector<unsigned char> &quantized, int bits, size_t i, int q) {
+	if (bits == 8)
+		quantized[i] = (unsigned char) q;
+	else {
+		quantized[i << 1] = (unsigned char) q;
+		quantized[(i << 1) + 1] = (unsigned char) (q >> 8);
+	}
+}
+
+float CurveTimeline::compress(int bits, float tolerance) {
+	assert(bits == 8 || bits == 16);
+	assert(!_quantizedBits);
+	size_t entries = getFrameEntries(), valueCount = entries - 1, frameCount = getFrameCount();
+	int levels = (1 << bits) - 1;
+
+	// The times at the keys, between them and at the bezier points, to measure the error. The range of the bezier x
+	// as a fraction of the time between the keys.
+	Vector<float> times, exact;
+	float curveLow = 0, curveHigh = 1;
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		float start = _frames[frame * entries];
+		times.add(start);
+		if (frame + 1 == frameCount) continue;
+		float duration = _frames[(frame + 1) * entries] - start;
+		for (int i = 1; i < 8; i++)
+			times.add(start + duration * (i * 0.125f));
+		int curveType = (int) _curves[frame];
+		if (curveType < BEZIER) continue;
+		for (size_t i = curveType - BEZIER, n = i + valueCount * BEZIER_SIZE; i < n; i += 2) {
+			float x = _curves[i];
+			if (x > start && x < start + duration) times.add(x);
+			curveLow = MathUtil::min(curveLow, (x - start) / duration);
+			curveHigh = MathUtil::max(curveHigh, (x - start) / duration);
+		}
+	}
+	for (size_t i = 0; i < times.size(); i++)
+		for (size_t value = 1; value <= valueCount; value++)
+			exact.add(getKeyValue(times[i], value));
+	_quantizedCurveOffset = curveLow;
+	_quantizedCurveScale = (curveHigh - curveLow) / levels;
+
+	// The range of each value, over the keys and the bezier curves.
+	bool constant = true;
+	_quantizedOffsets.ensureCapacity(valueCount);
+	_quantizedScales.ensureCapacity(valueCount);
+	for (size_t value = 0; value < valueCount; value++) {
+		float low = _frames[value + 1], high = low;
+		for (size_t frame = 0; frame < frameCount; frame++) {
+			float y = _frames[frame * entries + value + 1];
+			low = MathUtil::min(low, y);
+			high = MathUtil::max(high, y);
+			int curveType = (int) _curves[frame];
+			if (curveType < BEZIER) continue;
+			for (size_t i = curveType - BEZIER + value * BEZIER_SIZE, n = i + BEZIER_SIZE; i < n; i += 2) {
+				low = MathUtil::min(low, _curves[i + 1]);
+				high = MathUtil::max(high, _curves[i + 1]);
+			}
+		}
+		if (high - low <= tolerance) {
+			_quantizedOffsets.add((low + high) / 2);
+			_quantizedScales.add(0);
+		} else {
+			_quantizedOffsets.add(low);
+			_quantizedScales.add((high - low) / levels);
+			_quantizedStride++;
+			constant = false;
+		}
+	}
+
+	// A timeline with only constant values needs only its first key.
+	Vector<size_t> keep;
+	keep.add(0);
+	if (!constant) {
+		for (size_t frame = 1; frame + 1 < frameCount; frame++)
+			if (!isRedundant(keep[keep.size() - 1], frame, tolerance)) keep.add(frame);
+		if (frameCount > 1) keep.add(frameCount - 1);
+	}
+
+	size_t bezierCount = 0;
+	for (size_t i = 0; i < keep.size(); i++)
+		if (!constant && _curves[keep[i]] >= BEZIER) bezierCount++;
+	size_t keyEntries = keep.size() * _quantizedStride, bezier = keyEntries;
+	size_t quantizedSize = (keyEntries + bezierCount * valueCount * BEZIER_SIZE) * (bits >> 3);
+	_quantized.ensureCapacity(quantizedSize);
+	_quantized.setSize(quantizedSize, 0);
+
+	Vector<float> frames, curves;
+	frames.ensureCapacity(keep.size());
+	curves.ensureCapacity(keep.size());
+	for (size_t i = 0; i < keep.size(); i++) {
+		size_t frame = keep[i];
+		for (size_t value = 0, slot = 0; value < valueCount; value++) {
+			float scale = _quantizedScales[value];
+			if (scale == 0) continue;
+			int q = quantize(_frames[frame * entries + value + 1], _quantizedOffsets[value], scale, levels);
+			setQuantized(_quantized, bits, i * _quantizedStride + slot++, q);
+		}
+		float start = _frames[frame * entries];
+		frames.add(start);
+		int curveType = constant || i + 1 == keep.size() ? STEPPED : (int) _curves[frame];
+		if (curveType < BEZIER) {
+			curves.add((float) curveType);
+			continue;
+		}
+
+		// Bezier x is stored relative to the key times, the keys around a bezier curve are never removed.
+		curves.add((float) (BEZIER + bezier - keyEntries));
+		float duration = _frames[(frame + 1) * entries] - start;
+		for (size_t value = 0; value < valueCount; value++) {
+			float offset = _quantizedOffsets[value], scale = _quantizedScales[value];
+			for (size_t ii = 0, c = curveType - BEZIER + value * BEZIER_SIZE; ii < BEZIER_SIZE; ii += 2) {
+				float x = (_curves[c + ii] - start) / duration;
+				setQuantized(_quantized, bits, bezier + ii,
+							 quantize(x, _quantizedCurveOffset, _quantizedCurveScale, levels));
+				if (scale == 0) continue;
+				setQuantized(_quantized, bits, bezier + ii + 1, quantize(_curves[c + ii + 1], offset, scale, levels));
+			}
+			bezier += BEZIER_SIZE;
+		}
+	}
+	_frames.clearAndAddAll(frames);
+	_frames.shrinkToFit();
+	_frameEntries = 1;
+	_curves.clearAndAddAll(curves);
+	_curves.shrinkToFit();
+	_quantizedBits = bits;
+
+	float error = 0, values[2];
+	assert(valueCount <= 2);
+	for (size_t i = 0; i < times.size(); i++) {
+		getQuantizedValues(times[i], values);
+		for (size_t value = 0; value < valueCount; value++)
+			error = MathUtil::max(error, MathUtil::abs(values[value] - exact[i * valueCount + value]));
+	}
+	return error;
+}
+
+bool CurveTimeline::isCompressed() {
+	return _quantizedBits != 0;
+}
+
+size_t CurveTimeline::getMemorySize() {
+	return Timeline::getMemorySize() + _quantized.getCapacity() +
+		   (_curves.getCapacity() + _quantizedOffsets.getCapacity() + _quantizedScales.getCapacity()) * sizeof(float);
+}
+
+float CurveTimeline::getKeyValue(float time, size_t value) {
+	size_t entries = getFrameEntries();
+	int i = Animation::search(_frames, time, (int) entries);
+	int curveType = (int) _curves[i / entries];
+	switch (curveType) {
+		case LINEAR: {
+			float before = _frames[i], y = _frames[i + value];
+			return y + (time - before) / (_frames[i + entries] - before) * (_frames[i + entries + value] - y);
+		}
+		case STEPPED:
+			return _frames[i + value];
+		default:
+			return getBezierValue(time, i, value, curveType - BEZIER + (value - 1) * BEZIER_SIZE);
+	}
+}
+
+bool CurveTimeline::isRedundant(size_t previous, size_t frame, float tolerance) {
+	size_t entries = getFrameEntries();
+	int previousType = (int) _curves[previous], curveType = (int) _curves[frame];
+	if (previousType == STEPPED && curveType == STEPPED) {
+		for (size_t value = 1; value < entries; value++)
+			if (MathUtil::abs(_frames[frame * entries + value] - _frames[previous * entries + value]) > tolerance)
+				return false;
+		return true;
+	}
+	if (previousType != LINEAR || curveType != LINEAR) return false;
+
+	// The keys removed since the previous key and this key must be on the line to the next key.
+	size_t next = frame + 1;
+	float start = _frames[previous * entries], duration = _frames[next * entries] - start;
+	if (duration <= 0) return false;
+	for (size_t key = previous + 1; key <= frame; key++) {
+		float t = (_frames[key * entries] - start) / duration;
+		for (size_t value = 1; value < entries; value++) {
+			float from = _frames[previous * entries + value], to = _frames[next * entries + value];
+			if (MathUtil::abs(from + (to - from) * t - _frames[key * entries + value]) > tolerance) return false;
+		}
+	}
+	return true;
+}
+
+int CurveTimeline::getQuantized(size_t i) {
+	if (_quantizedBits == 8) return _quantized[i];
+	return _quantized[i << 1] | (_quantized[(i << 1) + 1] << 8);
+}
+
+float CurveTimeline::getQuantizedKey(size_t frame, size_t value) {
+	float scale = _quantizedScales[value];
+	if (scale == 0) return _quantizedOffsets[value];
+	size_t slot = 0;
+	for (size_t i = 0; i < value; i++)
+		if (_quantizedScales[i] != 0) slot++;
+	return _quantizedOffsets[value] + getQuantized(frame * _quantizedStride + slot) * scale;
+}
+
+void CurveTimeline::getQuantizedValues(float time, float *values) {
+	size_t valueCount = _quantizedScales.size();
+	int i = Animation::search(_frames, time, 1);
+	int curveType = (int) _curves[i];
+	switch (curveType) {
+		case LINEAR: {
+			float before = _frames[i], t = (time - before) / (_frames[i + 1] - before);
+			for (size_t value = 0; value < valueCount; value++) {
+				float y = getQuantizedKey(i, value);
+				values[value] = y + (getQuantizedKey(i + 1, value) - y) * t;
+			}
+			break;
+		}
+		case STEPPED:
+			for (size_t value = 0; value < valueCount; value++)
+				values[value] = getQuantizedKey(i, value);
+			break;
+		default:
+			for (size_t value = 0; value < valueCount; value++)
+				values[value] = getQuantizedBezierValue(time, i, value, curveType - BEZIER + value * BEZIER_SIZE);
+	}
+}
+
+float CurveTimeline::getQuantizedBezierValue(float time, size_t frame, size_t value, size_t i) {
+	i += _frames.size() * _quantizedStride;
+	float start = _frames[frame], end = _frames[frame + 1], duration = end - start;
+	float offset = _quantizedOffsets[value], scale = _quantizedScales[value];
+	float curveStart = start + _quantizedCurveOffset * duration, step = _quantizedCurveScale * duration;
+	float x = curveStart + getQuantized(i) * step;
+	if (x > time) {
+		float y = getQuantizedKey(frame, value);
+		return y + (time - start) / (x - start) * (offset + getQuantized(i + 1) * scale - y);
+	}
+	size_t n = i + BEZIER_SIZE;
+	for (i += 2; i < n; i += 2) {
+		float x2 = curveStart + getQuantized(i) * step;
+		if (x2 >= time && x2 > x) {
+			float y = offset + getQuantized(i - 1) * scale;
+			return y + (time - x) / (x2 - x) * (offset + getQuantized(i + 1) * scale - y);
+		}
+		x = x2;
+	}
+	float y = offset + getQuantized(n - 1) * scale;
+	return y + (time - x) / (end - x) * (getQuantizedKey(frame + 1, value) - y);
+}
+
 RTTI_IMPL(CurveTimeline1, CurveTimeline)
 
 CurveTimeline1::CurveTimeline1(size_t frameCount, size_t bezierCount) : CurveTimeline(frameCount,
@@ -111,13 +370,17 @@ void CurveTimeline1::setFrame(size_t frame, float time, float value) {
 }
 
 float CurveTimeline1::getCurveValue(float time) {
-	int i = (int) _frames.size() - 2;
-	for (int ii = 2; ii <= i; ii += 2) {
-		if (_frames[ii] > time) {
-			i = ii - 2;
-			break;
-		}
+	if (_bakedChannel != -1) {
+		const float *baked = Animation::getBakedValues();
+		if (baked) return baked[_bakedChannel];
 	}
+	if (_quantizedBits) {
+		float value;
+		getQuantizedValues(time, &value);
+		return value;
+	}
+
+	int i = Animation::search(_frames, time, CurveTimeline1::ENTRIES);
 
 	int curveType = (int) _curves[i >> 1];
 	switch (curveType) {
@@ -148,3 +411,45 @@ void CurveTimeline2::setFrame(size_t frame, float time, float value1, float valu
 	_frames[frame + CurveTimeline2::VALUE1] = value1;
 	_frames[frame + CurveTimeline2::VALUE2] = value2;
 }
+
+void CurveTimeline2::getCurveValues(float time, float &value1, float &value2) {
+	if (_bakedChannel != -1) {
+		const float *baked = Animation::getBakedValues();
+		if (baked) {
+			value1 = baked[_bakedChannel];
+			value2 = baked[_bakedChannel + 1];
+			return;
+		}
+	}
+	if (_quantizedBits) {
+		float values[2];
+		getQuantizedValues(time, values);
+		value1 = values[0];
+		value2 = values[1];
+		return;
+	}
+
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
+	switch (curveType) {
+		case CurveTimeline::LINEAR: {
+			float before = _frames[i];
+			value1 = _frames[i + CurveTimeline2::VALUE1];
+			value2 = _frames[i + CurveTimeline2::VALUE2];
+			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
+			value1 += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - value1) * t;
+			value2 += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - value2) * t;
+			break;
+		}
+		case CurveTimeline::STEPPED: {
+			value1 = _frames[i + CurveTimeline2::VALUE1];
+			value2 = _frames[i + CurveTimeline2::VALUE2];
+			break;
+		}
+		default: {
+			value1 = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
+			value2 = getBezierValue(time, i, CurveTimeline2::VALUE2,
+									curveType + CurveTimeline::BEZIER_SIZE - CurveTimeline::BEZIER);
+		}
+	}
+}
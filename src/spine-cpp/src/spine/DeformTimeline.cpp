@@ -319,6 +319,13 @@ Vector<Vector<float>> &DeformTimeline::getVertices() {
 	return _vertices;
 }
 
+size_t DeformTimeline::getMemorySize() {
+	size_t size = CurveTimeline::getMemorySize() + _vertices.getCapacity() * sizeof(Vector<float>);
+	for (size_t i = 0; i < _vertices.size(); i++)
+		size += _vertices[i].getCapacity() * sizeof(float);
+	return size;
+}
+
 VertexAttachment *DeformTimeline::getAttachment() {
 	return _attachment;
 }
@@ -28,6 +28,7 @@
  *****************************************************************************/
 
 #include <spine/MathUtil.h>
+#include <spine/SimdUtil.h>
 #include <math.h>
 #include <stdlib.h>
 
@@ -66,14 +67,53 @@ float MathUtil::atan2(float y, float x) {
 	return (float) ::atan2(y, x);
 }
 
-/// Returns the cosine in radians from a lookup table.
+#ifdef SPINE_FAST_TRIG
+static bool fastTrig = true;
+#else
+static bool fastTrig = false;
+#endif
+
+// Computes the sine and cosine in degrees for |degrees| < 2^22. Subtracts the nearest multiple of 90 degrees, which is
+// exact, evaluates the Taylor polynomials on the remaining [-Pi / 4, Pi / 4] and rotates the result into the quadrant.
+// The batched sinCosDeg does the same operations lane wise and gives the same results.
+static const float roundBias = 12582912.0f; // 1.5 * 2^23, adding it drops the fraction with round to nearest.
+
+static inline void fastSinCosDeg(float degrees, float &sine, float &cosine) {
+	float q = (degrees * (1 / 90.0f) + roundBias) - roundBias;
+	float t = (degrees - q * 90) * MathUtil::Deg_Rad, t2 = t * t;
+	float s = t * (1 + t2 * (-1 / 6.0f + t2 * (1 / 120.0f + t2 * (-1 / 5040.0f))));
+	float c = 1 + t2 * (-1 / 2.0f + t2 * (1 / 24.0f + t2 * (-1 / 720.0f + t2 * (1 / 40320.0f))));
+	// Selects and negates without branches, the quadrant changes with every call.
+	int quadrant = (int) q & 3;
+	float values[2] = {s, c};
+	sine = values[quadrant & 1] * (float) (1 - (quadrant & 2));
+	cosine = values[(quadrant & 1) ^ 1] * (float) (1 - ((quadrant + 1) & 2));
+}
+
+static const float maxFastDegrees = 4194304.0f; // 2^22
+
+void MathUtil::setFastTrig(bool fast) {
+	fastTrig = fast;
+}
+
+bool MathUtil::isFastTrig() {
+	return fastTrig;
+}
+
 float MathUtil::cos(float radians) {
-	return (float) ::cos(radians);
+	float degrees = radians * Rad_Deg;
+	if (!fastTrig || !(abs(degrees) < maxFastDegrees)) return (float) ::cos(radians);
+	float sine, cosine;
+	fastSinCosDeg(degrees, sine, cosine);
+	return cosine;
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sin(float radians) {
-	return (float) ::sin(radians);
+	float degrees = radians * Rad_Deg;
+	if (!fastTrig || !(abs(degrees) < maxFastDegrees)) return (float) ::sin(radians);
+	float sine, cosine;
+	fastSinCosDeg(degrees, sine, cosine);
+	return sine;
 }
 
 float MathUtil::sqrt(float v) {
@@ -84,14 +124,69 @@ float MathUtil::acos(float v) {
 	return (float) ::acos(v);
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sinDeg(float degrees) {
-	return (float) ::sin(degrees * MathUtil::Deg_Rad);
+	if (!fastTrig || !(abs(degrees) < maxFastDegrees)) return (float) ::sin(degrees * MathUtil::Deg_Rad);
+	float sine, cosine;
+	fastSinCosDeg(degrees, sine, cosine);
+	return sine;
 }
 
-/// Returns the cosine in radians from a lookup table.
 float MathUtil::cosDeg(float degrees) {
-	return (float) ::cos(degrees * MathUtil::Deg_Rad);
+	if (!fastTrig || !(abs(degrees) < maxFastDegrees)) return (float) ::cos(degrees * MathUtil::Deg_Rad);
+	float sine, cosine;
+	fastSinCosDeg(degrees, sine, cosine);
+	return cosine;
+}
+
+void MathUtil::sinCosDeg(float degrees, float &sine, float &cosine) {
+	if (!fastTrig || !(abs(degrees) < maxFastDegrees)) {
+		float radians = degrees * MathUtil::Deg_Rad;
+		sine = (float) ::sin(radians);
+		cosine = (float) ::cos(radians);
+		return;
+	}
+	fastSinCosDeg(degrees, sine, cosine);
+}
+
+void MathUtil::sinCosDeg(const float *degrees, float *sines, float *cosines, size_t count) {
+	if (!fastTrig) {
+		for (size_t i = 0; i < count; i++) {
+			float radians = degrees[i] * MathUtil::Deg_Rad;
+			sines[i] = (float) ::sin(radians);
+			cosines[i] = (float) ::cos(radians);
+		}
+		return;
+	}
+	size_t i = 0;
+#ifdef SPINE_SIMD_WIDTH
+	SimdFloat bias = simdSet(roundBias), one = simdSet(1), two = simdSet(2);
+	for (; i + SPINE_SIMD_WIDTH <= count; i += SPINE_SIMD_WIDTH) {
+		SimdFloat angle = simdLoad(degrees + i);
+		SimdFloat q = simdSub(simdAdd(simdMul(angle, simdSet(1 / 90.0f)), bias), bias);
+		SimdFloat t = simdMul(simdSub(angle, simdMul(q, simdSet(90))), simdSet(MathUtil::Deg_Rad)), t2 = simdMul(t, t);
+		SimdFloat s = simdAdd(simdMul(t2, simdSet(-1 / 5040.0f)), simdSet(1 / 120.0f));
+		s = simdAdd(simdMul(t2, s), simdSet(-1 / 6.0f));
+		s = simdMul(simdAdd(simdMul(t2, s), one), t);
+		SimdFloat c = simdAdd(simdMul(t2, simdSet(1 / 40320.0f)), simdSet(-1 / 720.0f));
+		c = simdAdd(simdMul(t2, c), simdSet(1 / 24.0f));
+		c = simdAdd(simdMul(t2, c), simdSet(-1 / 2.0f));
+		c = simdAdd(simdMul(t2, c), one);
+		// The quadrant modulo 4 in -2..2, kept in floats so no integer vector operations are needed.
+		SimdFloat quadrant = simdSub(q, simdMul(simdSet(4), simdSub(simdAdd(simdMul(q, simdSet(0.25f)), bias), bias)));
+		SimdMask odd = simdOr(simdEqual(quadrant, one), simdEqual(quadrant, simdSet(-1)));
+		SimdMask half = simdOr(simdEqual(quadrant, two), simdEqual(quadrant, simdSet(-2)));
+		SimdFloat qs = simdSelect(odd, c, s), qc = simdSelect(odd, s, c);
+		simdStore(sines + i, simdNegateIf(simdOr(half, simdEqual(quadrant, simdSet(-1))), qs));
+		simdStore(cosines + i, simdNegateIf(simdOr(half, simdEqual(quadrant, one)), qc));
+	}
+#endif
+	for (; i < count; i++) {
+		float angle = degrees[i];
+		if (abs(angle) < maxFastDegrees) fastSinCosDeg(angle, sines[i], cosines[i]);
+	}
+	for (size_t i = 0; i < count; i++) {
+		if (!(abs(degrees[i]) < maxFastDegrees)) sinCosDeg(degrees[i], sines[i], cosines[i]);
+	}
 }
 
 /* Need to pass 0 as an argument, so VC++ doesn't error with C2124 */
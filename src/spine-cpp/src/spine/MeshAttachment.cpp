@@ -29,6 +29,7 @@
 
 #include <spine/MeshAttachment.h>
 #include <spine/HasRendererObject.h>
+#include <spine/Triangulator.h>
 
 using namespace spine;
 
@@ -118,6 +119,7 @@ int MeshAttachment::getHullLength() {
 
 void MeshAttachment::setHullLength(int inValue) {
 	_hullLength = inValue;
+	_hullTriangles.clear();
 }
 
 Vector<float> &MeshAttachment::getRegionUVs() {
@@ -132,6 +134,35 @@ Vector<unsigned short> &MeshAttachment::getTriangles() {
 	return _triangles;
 }
 
+Vector<unsigned short> &MeshAttachment::getHullTriangles() {
+	if (_hullTriangles.size() > 0 || _hullLength < 6) return _hullTriangles;
+
+	// Triangulate the hull in image space, with y up and clockwise as the triangulator expects
+	int hullCount = _hullLength >> 1;
+	Vector<float> polygon;
+	polygon.setSize(_hullLength, 0);
+	float area = 0;
+	for (int i = 0, ii = hullCount - 1; i < hullCount; ii = i++) {
+		polygon[i << 1] = _regionUVs[i << 1];
+		polygon[(i << 1) + 1] = -_regionUVs[(i << 1) + 1];
+		area += _regionUVs[ii << 1] * -_regionUVs[(i << 1) + 1] - _regionUVs[i << 1] * -_regionUVs[(ii << 1) + 1];
+	}
+	bool reversed = area > 0;
+	if (reversed) {
+		for (int i = 0; i < hullCount; ++i) {
+			polygon[i << 1] = _regionUVs[(hullCount - 1 - i) << 1];
+			polygon[(i << 1) + 1] = -_regionUVs[((hullCount - 1 - i) << 1) + 1];
+		}
+	}
+	Triangulator triangulator;
+	Vector<int> &triangles = triangulator.triangulate(polygon);
+
+	_hullTriangles.setSize(triangles.size(), 0);
+	for (size_t i = 0, n = triangles.size(); i < n; ++i)
+		_hullTriangles[i] = (unsigned short) (reversed ? hullCount - 1 - triangles[i] : triangles[i]);
+	return _hullTriangles;
+}
+
 const String &MeshAttachment::getPath() {
 	return _path;
 }
@@ -169,6 +200,7 @@ void MeshAttachment::setParentMesh(MeshAttachment *inValue) {
 		_regionUVs.clearAndAddAll(inValue->_regionUVs);
 		_triangles.clearAndAddAll(inValue->_triangles);
 		_hullLength = inValue->_hullLength;
+		_hullTriangles.clearAndAddAll(inValue->_hullTriangles);
 		_edges.clearAndAddAll(inValue->_edges);
 		_width = inValue->_width;
 		_height = inValue->_height;
@@ -214,6 +246,7 @@ Attachment *MeshAttachment::copy() {
 	copy->_uvs.clearAndAddAll(_uvs);
 	copy->_triangles.clearAndAddAll(_triangles);
 	copy->_hullLength = _hullLength;
+	copy->_hullTriangles.clearAndAddAll(_hullTriangles);
 
 	// Nonessential.
 	copy->_edges.clearAndAddAll(copy->_edges);
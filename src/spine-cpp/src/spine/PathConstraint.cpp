@@ -49,8 +49,7 @@ const int PathConstraint::AFTER = -3;
 
 PathConstraint::PathConstraint(PathConstraintData &data, Skeleton &skeleton) : Updatable(),
 																			   _data(data),
-																			   _target(skeleton.findSlot(
-																					   data.getTarget()->getName())),
+																			   _target(skeleton.getSlots()[data.getTarget()->getIndex()]),
 																			   _position(data.getPosition()),
 																			   _spacing(data.getSpacing()),
 																			   _mixRotate(data.getMixRotate()),
@@ -60,7 +59,7 @@ PathConstraint::PathConstraint(PathConstraintData &data, Skeleton &skeleton) : U
 	_bones.ensureCapacity(_data.getBones().size());
 	for (size_t i = 0; i < _data.getBones().size(); i++) {
 		BoneData *boneData = _data.getBones()[i];
-		_bones.add(skeleton.findBone(boneData->getName()));
+		_bones.add(skeleton.getBones()[boneData->getIndex()]);
 	}
 
 	_segments.setSize(10, 0);
@@ -94,7 +93,7 @@ void PathConstraint::update() {
 					if (setupLength < PathConstraint::EPSILON) {
 						_lengths[i] = 0;
 					} else {
-						float x = setupLength * bone._a, y = setupLength * bone._c;
+						float x = setupLength * bone._a(), y = setupLength * bone._c();
 						_lengths[i] = MathUtil::sqrt(x * x + y * y);
 					}
 				}
@@ -114,7 +113,7 @@ void PathConstraint::update() {
 					if (scale) _lengths[i] = 0;
 					_spaces[++i] = spacing;
 				} else {
-					float x = setupLength * bone._a, y = setupLength * bone._c;
+					float x = setupLength * bone._a(), y = setupLength * bone._c();
 					float length = MathUtil::sqrt(x * x + y * y);
 					if (scale) _lengths[i] = length;
 					_spaces[++i] = length;
@@ -139,7 +138,7 @@ void PathConstraint::update() {
 					if (scale) _lengths[i] = 0;
 					_spaces[++i] = spacing;
 				} else {
-					float x = setupLength * bone._a, y = setupLength * bone._c;
+					float x = setupLength * bone._a(), y = setupLength * bone._c();
 					float length = MathUtil::sqrt(x * x + y * y);
 					if (scale) _lengths[i] = length;
 					_spaces[++i] = (lengthSpacing ? setupLength + spacing : spacing) * length / setupLength;
@@ -164,8 +163,8 @@ void PathConstraint::update() {
 	for (size_t i = 0, p = 3; i < boneCount; i++, p += 3) {
 		Bone *boneP = _bones[i];
 		Bone &bone = *boneP;
-		bone._worldX += (boneX - bone._worldX) * mixX;
-		bone._worldY += (boneY - bone._worldY) * mixY;
+		bone._worldX() += (boneX - bone._worldX()) * mixX;
+		bone._worldY() += (boneY - bone._worldY()) * mixY;
 		float x = positions[p];
 		float y = positions[p + 1];
 		float dx = x - boneX;
@@ -174,8 +173,8 @@ void PathConstraint::update() {
 			float length = _lengths[i];
 			if (length >= PathConstraint::EPSILON) {
 				float s = (MathUtil::sqrt(dx * dx + dy * dy) / length - 1) * mixRotate + 1;
-				bone._a *= s;
-				bone._c *= s;
+				bone._a() *= s;
+				bone._c() *= s;
 			}
 		}
 
@@ -183,7 +182,7 @@ void PathConstraint::update() {
 		boneY = y;
 
 		if (mixRotate > 0) {
-			float a = bone._a, b = bone._b, c = bone._c, d = bone._d, r, cos, sin;
+			float a = bone._a(), b = bone._b(), c = bone._c(), d = bone._d(), r, cos, sin;
 			if (tangents)
 				r = positions[p - 1];
 			else if (_spaces[i + 1] < PathConstraint::EPSILON)
@@ -210,10 +209,10 @@ void PathConstraint::update() {
 			r *= mixRotate;
 			cos = MathUtil::cos(r);
 			sin = MathUtil::sin(r);
-			bone._a = cos * a - sin * c;
-			bone._b = cos * b - sin * d;
-			bone._c = sin * a + cos * c;
-			bone._d = sin * b + cos * d;
+			bone._a() = cos * a - sin * c;
+			bone._b() = cos * b - sin * d;
+			bone._c() = sin * a + cos * c;
+			bone._d() = sin * b + cos * d;
 		}
 
 		bone.updateAppliedTransform();
@@ -0,0 +1,245 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/PoseCache.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/Property.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonPose.h>
+#include <spine/Timeline.h>
+
+#include <assert.h>
+#include <math.h>
+
+#ifdef SPINE_THREAD_SAFE_POSE_CACHE
+#define LOCK_POSE_CACHE() std::lock_guard<std::mutex> lock(_mutex)
+#else
+#define LOCK_POSE_CACHE()
+#endif
+
+using namespace spine;
+
+PoseCache::PoseKey::PoseKey(Animation *animation, int frame, MixBlend blend) : _animation(animation), _frame(frame),
+																			   _blend(blend) {
+}
+
+bool PoseCache::PoseKey::operator==(const PoseKey &other) const {
+	return _animation == other._animation && _frame == other._frame && _blend == other._blend;
+}
+
+size_t PoseCache::PoseKey::hashCode() const {
+	return (HashCode<Animation *>::hash(_animation) * 31 + HashCode<int>::hash(_frame)) * 31 + _blend;
+}
+
+PoseCache::PoseCache(float rate, size_t maxMemory) : _rate(rate), _maxMemory(maxMemory), _memorySize(0), _hits(0),
+													 _misses(0), _evictions(0), _first(NULL), _last(NULL) {
+	assert(rate > 0);
+}
+
+PoseCache::~PoseCache() {
+	evict(0);
+	HashMap<Animation *, Layout *>::Entries entries = _layouts.getEntries();
+	while (entries.hasNext())
+		delete entries.next().value;
+}
+
+const bool *PoseCache::apply(Animation &animation, Skeleton &skeleton, float time, MixBlend blend) {
+	int frame = (int) floorf(time * _rate + 0.5f);
+	PoseKey key(&animation, frame, blend);
+	float *components[PoseComponent_Count];
+	for (int i = 0; i < PoseComponent_Count; i++)
+		components[i] = skeleton.getPose().getComponent((PoseComponent) i);
+
+	Layout *layout;
+	{
+		LOCK_POSE_CACHE();
+		layout = getLayout(animation);
+		Pose *pose = _poses.get(key, NULL);
+		if (pose) {
+			_hits++;
+			const float *values = pose->_values.buffer();
+			for (size_t i = 0, n = layout->_bones.size(); i < n; i++)
+				components[layout->_components[i]][layout->_bones[i]] = values[i];
+			if (pose != _first) {
+				unlink(pose);
+				pose->_next = _first;
+				_first->_previous = pose;
+				_first = pose;
+			}
+			return layout->_timelines.buffer();
+		}
+		_misses++;
+	}
+
+	// Apply the bone timelines unlocked, with the curves rather than values baked for the unquantized time.
+	const float *bakedValues = Animation::getBakedValues();
+	Animation::setBakedValues(NULL);
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	float poseTime = frame / _rate;
+	for (size_t i = 0, n = timelines.size(); i < n; i++)
+		if (layout->_timelines[i]) timelines[i]->apply(skeleton, poseTime, poseTime, NULL, 1, blend, MixDirection_In);
+	Animation::setBakedValues(bakedValues);
+
+	Vector<Bone *> &bones = skeleton.getBones();
+	size_t count = layout->_bones.size();
+	for (size_t i = 0; i < count; i++)
+		if (!bones[layout->_bones[i]]->isActive()) return layout->_timelines.buffer();
+	Pose *pose = new (__FILE__, __LINE__) Pose();
+	pose->_key = key;
+	pose->_values.ensureCapacity(count);
+	for (size_t i = 0; i < count; i++)
+		pose->_values.add(components[layout->_components[i]][layout->_bones[i]]);
+	pose->_previous = NULL;
+
+	LOCK_POSE_CACHE();
+	size_t size = getSize(pose);
+	if (size > _maxMemory || _poses.containsKey(key)) {
+		delete pose;
+		return layout->_timelines.buffer();
+	}
+	evict(_maxMemory - size);
+	pose->_next = _first;
+	if (_first) _first->_previous = pose;
+	_first = pose;
+	if (!_last) _last = pose;
+	_poses.put(key, pose);
+	_memorySize += size;
+	return layout->_timelines.buffer();
+}
+
+void PoseCache::clear() {
+	LOCK_POSE_CACHE();
+	size_t evictions = _evictions;
+	evict(0);
+	_evictions = evictions;
+}
+
+float PoseCache::getRate() {
+	return _rate;
+}
+
+size_t PoseCache::getMaxMemory() {
+	return _maxMemory;
+}
+
+void PoseCache::setMaxMemory(size_t maxMemory) {
+	LOCK_POSE_CACHE();
+	_maxMemory = maxMemory;
+	evict(maxMemory);
+}
+
+size_t PoseCache::getMemorySize() {
+	LOCK_POSE_CACHE();
+	return _memorySize;
+}
+
+size_t PoseCache::getPoseCount() {
+	LOCK_POSE_CACHE();
+	return _poses.size();
+}
+
+size_t PoseCache::getHits() {
+	LOCK_POSE_CACHE();
+	return _hits;
+}
+
+size_t PoseCache::getMisses() {
+	LOCK_POSE_CACHE();
+	return _misses;
+}
+
+size_t PoseCache::getEvictions() {
+	LOCK_POSE_CACHE();
+	return _evictions;
+}
+
+void PoseCache::resetStatistics() {
+	LOCK_POSE_CACHE();
+	_hits = 0;
+	_misses = 0;
+	_evictions = 0;
+}
+
+PoseCache::Layout *PoseCache::getLayout(Animation &animation) {
+	Layout *layout = _layouts.get(&animation, NULL);
+	if (layout) return layout;
+
+	// The bone properties, in the order of their PoseComponent.
+	static const int properties[] = {Property_X, Property_Y, Property_Rotate, Property_ScaleX, Property_ScaleY,
+									 Property_ShearX, Property_ShearY};
+	layout = new (__FILE__, __LINE__) Layout();
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	for (size_t i = 0, n = timelines.size(); i < n; i++) {
+		Vector<PropertyId> &ids = timelines[i]->getPropertyIds();
+		bool bone = ids.size() > 0;
+		for (size_t ii = 0; ii < ids.size(); ii++)
+			if ((ids[ii] >> 32) > Property_ShearY) bone = false;
+		layout->_timelines.add(bone);
+		if (!bone) continue;
+		for (size_t ii = 0; ii < ids.size(); ii++) {
+			int component = 0;
+			while (properties[component] != (int) (ids[ii] >> 32))
+				component++;
+			layout->_bones.add((int) (ids[ii] & 0xffffffff));
+			layout->_components.add(component);
+		}
+	}
+	_layouts.put(&animation, layout);
+	return layout;
+}
+
+size_t PoseCache::getSize(Pose *pose) {
+	return sizeof(Pose) + pose->_values.getCapacity() * sizeof(float);
+}
+
+void PoseCache::unlink(Pose *pose) {
+	if (pose->_previous)
+		pose->_previous->_next = pose->_next;
+	else
+		_first = pose->_next;
+	if (pose->_next)
+		pose->_next->_previous = pose->_previous;
+	else
+		_last = pose->_previous;
+	pose->_previous = NULL;
+	pose->_next = NULL;
+}
+
+void PoseCache::evict(size_t maxMemory) {
+	while (_last && _memorySize > maxMemory) {
+		Pose *pose = _last;
+		unlink(pose);
+		_poses.remove(pose->_key);
+		_memorySize -= getSize(pose);
+		_evictions++;
+		delete pose;
+	}
+}
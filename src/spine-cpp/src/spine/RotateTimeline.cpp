@@ -60,10 +60,10 @@ void RotateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_rotation = bone->_data._rotation;
+				bone->_rotation() = bone->_data._rotation;
 				return;
 			case MixBlend_First:
-				bone->_rotation += (bone->_data._rotation - bone->_rotation) * alpha;
+				bone->_rotation() += (bone->_data._rotation - bone->_rotation()) * alpha;
 			default: {
 			}
 		}
@@ -73,12 +73,12 @@ void RotateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	float r = getCurveValue(time);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_rotation = bone->_data._rotation + r * alpha;
+			bone->_rotation() = bone->_data._rotation + r * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			r += bone->_data._rotation - bone->_rotation;
+			r += bone->_data._rotation - bone->_rotation();
 		case MixBlend_Add:
-			bone->_rotation += r * alpha;
+			bone->_rotation() += r * alpha;
 	}
 }
@@ -62,12 +62,12 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_scaleX = bone->_data._scaleX;
-				bone->_scaleY = bone->_data._scaleY;
+				bone->_scaleX() = bone->_data._scaleX;
+				bone->_scaleY() = bone->_data._scaleY;
 				return;
 			case MixBlend_First:
-				bone->_scaleX += (bone->_data._scaleX - bone->_scaleX) * alpha;
-				bone->_scaleY += (bone->_data._scaleY - bone->_scaleY) * alpha;
+				bone->_scaleX() += (bone->_data._scaleX - bone->_scaleX()) * alpha;
+				bone->_scaleY() += (bone->_data._scaleY - bone->_scaleY()) * alpha;
 			default: {
 			}
 		}
@@ -75,39 +75,17 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
-	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
-	switch (curveType) {
-		case CurveTimeline::LINEAR: {
-			float before = _frames[i];
-			x = _frames[i + CurveTimeline2::VALUE1];
-			y = _frames[i + CurveTimeline2::VALUE2];
-			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
-			x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
-			y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
-			break;
-		}
-		case CurveTimeline::STEPPED: {
-			x = _frames[i + CurveTimeline2::VALUE1];
-			y = _frames[i + CurveTimeline2::VALUE2];
-			break;
-		}
-		default: {
-			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
-			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline2::BEZIER_SIZE - CurveTimeline2::BEZIER);
-		}
-	}
+	getCurveValues(time, x, y);
 	x *= bone->_data._scaleX;
 	y *= bone->_data._scaleY;
 
 	if (alpha == 1) {
 		if (blend == MixBlend_Add) {
-			bone->_scaleX += x - bone->_data._scaleX;
-			bone->_scaleY += y - bone->_data._scaleY;
+			bone->_scaleX() += x - bone->_data._scaleX;
+			bone->_scaleY() += y - bone->_data._scaleY;
 		} else {
-			bone->_scaleX = x;
-			bone->_scaleY = y;
+			bone->_scaleX() = x;
+			bone->_scaleY() = y;
 		}
 	} else {
 		float bx, by;
@@ -116,38 +94,38 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 				case MixBlend_Setup:
 					bx = bone->_data._scaleX;
 					by = bone->_data._scaleY;
-					bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
-					bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
+					bone->_scaleX() = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+					bone->_scaleY() = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
 					break;
 				case MixBlend_First:
 				case MixBlend_Replace:
-					bx = bone->_scaleX;
-					by = bone->_scaleY;
-					bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
-					bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
+					bx = bone->_scaleX();
+					by = bone->_scaleY();
+					bone->_scaleX() = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+					bone->_scaleY() = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
 					break;
 				case MixBlend_Add:
-					bone->_scaleX += (x - bone->_data._scaleX) * alpha;
-					bone->_scaleY += (y - bone->_data._scaleY) * alpha;
+					bone->_scaleX() += (x - bone->_data._scaleX) * alpha;
+					bone->_scaleY() += (y - bone->_data._scaleY) * alpha;
 			}
 		} else {
 			switch (blend) {
 				case MixBlend_Setup:
 					bx = MathUtil::abs(bone->_data._scaleX) * MathUtil::sign(x);
 					by = MathUtil::abs(bone->_data._scaleY) * MathUtil::sign(y);
-					bone->_scaleX = bx + (x - bx) * alpha;
-					bone->_scaleY = by + (y - by) * alpha;
+					bone->_scaleX() = bx + (x - bx) * alpha;
+					bone->_scaleY() = by + (y - by) * alpha;
 					break;
 				case MixBlend_First:
 				case MixBlend_Replace:
-					bx = MathUtil::abs(bone->_scaleX) * MathUtil::sign(x);
-					by = MathUtil::abs(bone->_scaleY) * MathUtil::sign(y);
-					bone->_scaleX = bx + (x - bx) * alpha;
-					bone->_scaleY = by + (y - by) * alpha;
+					bx = MathUtil::abs(bone->_scaleX()) * MathUtil::sign(x);
+					by = MathUtil::abs(bone->_scaleY()) * MathUtil::sign(y);
+					bone->_scaleX() = bx + (x - bx) * alpha;
+					bone->_scaleY() = by + (y - by) * alpha;
 					break;
 				case MixBlend_Add:
-					bone->_scaleX += (x - bone->_data._scaleX) * alpha;
-					bone->_scaleY += (y - bone->_data._scaleY) * alpha;
+					bone->_scaleX() += (x - bone->_data._scaleX) * alpha;
+					bone->_scaleY() += (y - bone->_data._scaleY) * alpha;
 			}
 		}
 	}
@@ -175,10 +153,10 @@ void ScaleXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_scaleX = bone->_data._scaleX;
+				bone->_scaleX() = bone->_data._scaleX;
 				return;
 			case MixBlend_First:
-				bone->_scaleX += (bone->_data._scaleX - bone->_scaleX) * alpha;
+				bone->_scaleX() += (bone->_data._scaleX - bone->_scaleX()) * alpha;
 			default: {
 			}
 		}
@@ -188,9 +166,9 @@ void ScaleXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	float x = getCurveValue(time) * bone->_data._scaleX;
 	if (alpha == 1) {
 		if (blend == MixBlend_Add)
-			bone->_scaleX += x - bone->_data._scaleX;
+			bone->_scaleX() += x - bone->_data._scaleX;
 		else
-			bone->_scaleX = x;
+			bone->_scaleX() = x;
 	} else {
 		// Mixing out uses sign of setup or current pose, else use sign of key.
 		float bx;
@@ -198,29 +176,29 @@ void ScaleXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 			switch (blend) {
 				case MixBlend_Setup:
 					bx = bone->_data._scaleX;
-					bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+					bone->_scaleX() = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
 					break;
 				case MixBlend_First:
 				case MixBlend_Replace:
-					bx = bone->_scaleX;
-					bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+					bx = bone->_scaleX();
+					bone->_scaleX() = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
 					break;
 				case MixBlend_Add:
-					bone->_scaleX += (x - bone->_data._scaleX) * alpha;
+					bone->_scaleX() += (x - bone->_data._scaleX) * alpha;
 			}
 		} else {
 			switch (blend) {
 				case MixBlend_Setup:
 					bx = MathUtil::abs(bone->_data._scaleX) * MathUtil::sign(x);
-					bone->_scaleX = bx + (x - bx) * alpha;
+					bone->_scaleX() = bx + (x - bx) * alpha;
 					break;
 				case MixBlend_First:
 				case MixBlend_Replace:
-					bx = MathUtil::abs(bone->_scaleX) * MathUtil::sign(x);
-					bone->_scaleX = bx + (x - bx) * alpha;
+					bx = MathUtil::abs(bone->_scaleX()) * MathUtil::sign(x);
+					bone->_scaleX() = bx + (x - bx) * alpha;
 					break;
 				case MixBlend_Add:
-					bone->_scaleX += (x - bone->_data._scaleX) * alpha;
+					bone->_scaleX() += (x - bone->_data._scaleX) * alpha;
 			}
 		}
 	}
@@ -248,10 +226,10 @@ void ScaleYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_scaleY = bone->_data._scaleY;
+				bone->_scaleY() = bone->_data._scaleY;
 				return;
 			case MixBlend_First:
-				bone->_scaleY += (bone->_data._scaleY - bone->_scaleY) * alpha;
+				bone->_scaleY() += (bone->_data._scaleY - bone->_scaleY()) * alpha;
 			default: {
 			}
 		}
@@ -261,9 +239,9 @@ void ScaleYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	float y = getCurveValue(time) * bone->_data._scaleY;
 	if (alpha == 1) {
 		if (blend == MixBlend_Add)
-			bone->_scaleY += y - bone->_data._scaleY;
+			bone->_scaleY() += y - bone->_data._scaleY;
 		else
-			bone->_scaleY = y;
+			bone->_scaleY() = y;
 	} else {
 		// Mixing out uses sign of setup or current pose, else use sign of key.
 		float by = 0;
@@ -271,29 +249,29 @@ void ScaleYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 			switch (blend) {
 				case MixBlend_Setup:
 					by = bone->_data._scaleY;
-					bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
+					bone->_scaleY() = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
 					break;
 				case MixBlend_First:
 				case MixBlend_Replace:
-					by = bone->_scaleY;
-					bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
+					by = bone->_scaleY();
+					bone->_scaleY() = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
 					break;
 				case MixBlend_Add:
-					bone->_scaleY += (y - bone->_data._scaleY) * alpha;
+					bone->_scaleY() += (y - bone->_data._scaleY) * alpha;
 			}
 		} else {
 			switch (blend) {
 				case MixBlend_Setup:
 					by = MathUtil::abs(bone->_data._scaleY) * MathUtil::sign(y);
-					bone->_scaleY = by + (y - by) * alpha;
+					bone->_scaleY() = by + (y - by) * alpha;
 					break;
 				case MixBlend_First:
 				case MixBlend_Replace:
-					by = MathUtil::abs(bone->_scaleY) * MathUtil::sign(y);
-					bone->_scaleY = by + (y - by) * alpha;
+					by = MathUtil::abs(bone->_scaleY()) * MathUtil::sign(y);
+					bone->_scaleY() = by + (y - by) * alpha;
 					break;
 				case MixBlend_Add:
-					bone->_scaleY += (y - bone->_data._scaleY) * alpha;
+					bone->_scaleY() += (y - bone->_data._scaleY) * alpha;
 			}
 		}
 	}
@@ -64,12 +64,12 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_shearX = bone->_data._shearX;
-				bone->_shearY = bone->_data._shearY;
+				bone->_shearX() = bone->_data._shearX;
+				bone->_shearY() = bone->_data._shearY;
 				return;
 			case MixBlend_First:
-				bone->_shearX += (bone->_data._shearX - bone->_shearX) * alpha;
-				bone->_shearY += (bone->_data._shearY - bone->_shearY) * alpha;
+				bone->_shearX() += (bone->_data._shearX - bone->_shearX()) * alpha;
+				bone->_shearY() += (bone->_data._shearY - bone->_shearY()) * alpha;
 			default: {
 			}
 		}
@@ -77,43 +77,21 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
-	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
-	switch (curveType) {
-		case CurveTimeline2::LINEAR: {
-			float before = _frames[i];
-			x = _frames[i + CurveTimeline2::VALUE1];
-			y = _frames[i + CurveTimeline2::VALUE2];
-			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
-			x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
-			y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
-			break;
-		}
-		case CurveTimeline2::STEPPED: {
-			x = _frames[i + CurveTimeline2::VALUE1];
-			y = _frames[i + CurveTimeline2::VALUE2];
-			break;
-		}
-		default: {
-			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
-			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline2::BEZIER_SIZE - CurveTimeline2::BEZIER);
-		}
-	}
+	getCurveValues(time, x, y);
 
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_shearX = bone->_data._shearX + x * alpha;
-			bone->_shearY = bone->_data._shearY + y * alpha;
+			bone->_shearX() = bone->_data._shearX + x * alpha;
+			bone->_shearY() = bone->_data._shearY + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_shearX += (bone->_data._shearX + x - bone->_shearX) * alpha;
-			bone->_shearY += (bone->_data._shearY + y - bone->_shearY) * alpha;
+			bone->_shearX() += (bone->_data._shearX + x - bone->_shearX()) * alpha;
+			bone->_shearY() += (bone->_data._shearY + y - bone->_shearY()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_shearX += x * alpha;
-			bone->_shearY += y * alpha;
+			bone->_shearX() += x * alpha;
+			bone->_shearY() += y * alpha;
 	}
 }
 
@@ -141,10 +119,10 @@ void ShearXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_shearX = bone->_data._shearX;
+				bone->_shearX() = bone->_data._shearX;
 				return;
 			case MixBlend_First:
-				bone->_shearX += (bone->_data._shearX - bone->_shearX) * alpha;
+				bone->_shearX() += (bone->_data._shearX - bone->_shearX()) * alpha;
 			default: {
 			}
 		}
@@ -154,14 +132,14 @@ void ShearXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	float x = getCurveValue(time);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_shearX = bone->_data._shearX + x * alpha;
+			bone->_shearX() = bone->_data._shearX + x * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_shearX += (bone->_data._shearX + x - bone->_shearX) * alpha;
+			bone->_shearX() += (bone->_data._shearX + x - bone->_shearX()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_shearX += x * alpha;
+			bone->_shearX() += x * alpha;
 	}
 }
 
@@ -189,10 +167,10 @@ void ShearYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_shearY = bone->_data._shearY;
+				bone->_shearY() = bone->_data._shearY;
 				return;
 			case MixBlend_First:
-				bone->_shearY += (bone->_data._shearY - bone->_shearY) * alpha;
+				bone->_shearY() += (bone->_data._shearY - bone->_shearY()) * alpha;
 			default: {
 			}
 		}
@@ -202,13 +180,13 @@ void ShearYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	float y = getCurveValue(time);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_shearY = bone->_data._shearY + y * alpha;
+			bone->_shearY() = bone->_data._shearY + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_shearY += (bone->_data._shearY + y - bone->_shearY) * alpha;
+			bone->_shearY() += (bone->_data._shearY + y - bone->_shearY()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_shearY += y * alpha;
+			bone->_shearY() += y * alpha;
 	}
 }
@@ -50,83 +50,355 @@
 #include <spine/ContainerUtil.h>
 
 #include <float.h>
+#include <limits.h>
 
 using namespace spine;
 
+// The size of the arena space for count objects, rounded so the next type starts aligned.
+template<typename T>
+static size_t arenaSize(size_t count) {
+	return (count * sizeof(T) + 15) & ~(size_t) 15;
+}
+
 Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
+												 _pose(skeletonData->getBones().size()),
 												 _skin(NULL),
 												 _color(1, 1, 1, 1),
 												 _scaleX(1),
 												 _scaleY(1),
 												 _x(0),
-												 _y(0) {
-	_bones.ensureCapacity(_data->getBones().size());
-	for (size_t i = 0; i < _data->getBones().size(); ++i) {
+												 _y(0),
+												 _incremental(false),
+												 _ikEnabled(true),
+												 _transformEnabled(true),
+												 _pathEnabled(true),
+												 _tracked(false),
+												 _skippedBones(0) {
+	createObjects();
+	updateCache();
+}
+
+Skeleton::Skeleton(Skeleton &prototype) : _data(prototype._data),
+										  _pose(prototype._data->getBones().size()),
+										  _skin(NULL),
+										  _color(1, 1, 1, 1),
+										  _scaleX(1),
+										  _scaleY(1),
+										  _x(0),
+										  _y(0),
+										  _incremental(false),
+										  _ikEnabled(true),
+										  _transformEnabled(true),
+										  _pathEnabled(true),
+										  _tracked(false),
+										  _skippedBones(0) {
+	createObjects();
+	setTo(prototype);
+}
+
+void Skeleton::createObjects() {
+	// The bones, slots and constraints are constructed in a single allocation, in index order.
+	size_t boneCount = _data->getBones().size(), slotCount = _data->getSlots().size();
+	size_t ikCount = _data->getIkConstraints().size(), transformCount = _data->getTransformConstraints().size();
+	size_t pathCount = _data->getPathConstraints().size();
+	_arena = SpineExtension::calloc<char>(arenaSize<Bone>(boneCount) + arenaSize<Slot>(slotCount) +
+												  arenaSize<IkConstraint>(ikCount) +
+												  arenaSize<TransformConstraint>(transformCount) +
+												  arenaSize<PathConstraint>(pathCount),
+										  __FILE__, __LINE__);
+	char *memory = _arena;
+
+	Vector<int> childCounts;
+	childCounts.setSize(boneCount, 0);
+	for (size_t i = 0; i < boneCount; ++i) {
+		BoneData *parent = _data->getBones()[i]->getParent();
+		if (parent) childCounts[parent->getIndex()]++;
+	}
+
+	_bones.ensureCapacity(boneCount);
+	for (size_t i = 0; i < boneCount; ++i) {
 		BoneData *data = _data->getBones()[i];
 
 		Bone *bone;
 		if (data->getParent() == NULL) {
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, NULL);
+			bone = new (memory + i * sizeof(Bone)) Bone(*data, *this, NULL);
 		} else {
 			Bone *parent = _bones[data->getParent()->getIndex()];
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, parent);
+			bone = new (memory + i * sizeof(Bone)) Bone(*data, *this, parent);
 			parent->getChildren().add(bone);
 		}
+		bone->getChildren().ensureCapacity(childCounts[i]);
 
 		_bones.add(bone);
 	}
+	memory += arenaSize<Bone>(boneCount);
 
-	_slots.ensureCapacity(_data->getSlots().size());
-	_drawOrder.ensureCapacity(_data->getSlots().size());
-	for (size_t i = 0; i < _data->getSlots().size(); ++i) {
+	_slots.ensureCapacity(slotCount);
+	_drawOrder.ensureCapacity(slotCount);
+	for (size_t i = 0; i < slotCount; ++i) {
 		SlotData *data = _data->getSlots()[i];
 
 		Bone *bone = _bones[data->getBoneData().getIndex()];
-		Slot *slot = new (__FILE__, __LINE__) Slot(*data, *bone);
+		Slot *slot = new (memory + i * sizeof(Slot)) Slot(*data, *bone);
 
 		_slots.add(slot);
 		_drawOrder.add(slot);
 	}
+	memory += arenaSize<Slot>(slotCount);
 
-	_ikConstraints.ensureCapacity(_data->getIkConstraints().size());
-	for (size_t i = 0; i < _data->getIkConstraints().size(); ++i) {
+	_ikConstraints.ensureCapacity(ikCount);
+	for (size_t i = 0; i < ikCount; ++i) {
 		IkConstraintData *data = _data->getIkConstraints()[i];
 
-		IkConstraint *constraint = new (__FILE__, __LINE__) IkConstraint(*data, *this);
+		IkConstraint *constraint = new (memory + i * sizeof(IkConstraint)) IkConstraint(*data, *this);
 
 		_ikConstraints.add(constraint);
 	}
+	memory += arenaSize<IkConstraint>(ikCount);
 
-	_transformConstraints.ensureCapacity(_data->getTransformConstraints().size());
-	for (size_t i = 0; i < _data->getTransformConstraints().size(); ++i) {
+	_transformConstraints.ensureCapacity(transformCount);
+	for (size_t i = 0; i < transformCount; ++i) {
 		TransformConstraintData *data = _data->getTransformConstraints()[i];
 
-		TransformConstraint *constraint = new (__FILE__, __LINE__) TransformConstraint(*data, *this);
+		TransformConstraint *constraint = new (memory + i * sizeof(TransformConstraint)) TransformConstraint(*data, *this);
 
 		_transformConstraints.add(constraint);
 	}
+	memory += arenaSize<TransformConstraint>(transformCount);
 
-	_pathConstraints.ensureCapacity(_data->getPathConstraints().size());
-	for (size_t i = 0; i < _data->getPathConstraints().size(); ++i) {
+	_pathConstraints.ensureCapacity(pathCount);
+	for (size_t i = 0; i < pathCount; ++i) {
 		PathConstraintData *data = _data->getPathConstraints()[i];
 
-		PathConstraint *constraint = new (__FILE__, __LINE__) PathConstraint(*data, *this);
+		PathConstraint *constraint = new (memory + i * sizeof(PathConstraint)) PathConstraint(*data, *this);
 
 		_pathConstraints.add(constraint);
 	}
-
-	updateCache();
 }
 
 Skeleton::~Skeleton() {
-	ContainerUtil::cleanUpVectorOfPointers(_bones);
-	ContainerUtil::cleanUpVectorOfPointers(_slots);
-	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
+	for (size_t i = 0, n = _bones.size(); i < n; ++i)
+		_bones[i]->~Bone();
+	for (size_t i = 0, n = _slots.size(); i < n; ++i)
+		_slots[i]->~Slot();
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; ++i)
+		_ikConstraints[i]->~IkConstraint();
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; ++i)
+		_transformConstraints[i]->~TransformConstraint();
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; ++i)
+		_pathConstraints[i]->~PathConstraint();
+	SpineExtension::free(_arena, __FILE__, __LINE__);
+}
+
+Skeleton *Skeleton::clone() {
+	return new (__FILE__, __LINE__) Skeleton(*this);
+}
+
+void Skeleton::setTo(Skeleton &skeleton) {
+	assert(_data == skeleton._data);
+	_skin = skeleton._skin;
+	_color.set(skeleton._color);
+	_x = skeleton._x;
+	_y = skeleton._y;
+	_scaleX = skeleton._scaleX;
+	_scaleY = skeleton._scaleY;
+	_pose.set(skeleton._pose);
+
+	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
+		Bone *bone = _bones[i], *from = skeleton._bones[i];
+		bone->_sorted = from->_sorted;
+		bone->_active = from->_active;
+	}
+
+	for (size_t i = 0, n = _slots.size(); i < n; ++i) {
+		Slot *slot = _slots[i], *from = skeleton._slots[i];
+		slot->_color.set(from->_color);
+		slot->_darkColor.set(from->_darkColor);
+		slot->_attachment = from->_attachment;
+		slot->_attachmentState = from->_attachmentState;
+		slot->_sequenceIndex = from->_sequenceIndex;
+		slot->_deform.clearAndAddAll(from->_deform);
+		_drawOrder[i] = _slots[skeleton._drawOrder[i]->_data.getIndex()];
+	}
+
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; ++i) {
+		IkConstraint *constraint = _ikConstraints[i], *from = skeleton._ikConstraints[i];
+		constraint->_bendDirection = from->_bendDirection;
+		constraint->_compress = from->_compress;
+		constraint->_stretch = from->_stretch;
+		constraint->_mix = from->_mix;
+		constraint->_softness = from->_softness;
+		constraint->_active = from->_active;
+	}
+
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; ++i) {
+		TransformConstraint *constraint = _transformConstraints[i], *from = skeleton._transformConstraints[i];
+		constraint->_mixRotate = from->_mixRotate;
+		constraint->_mixX = from->_mixX;
+		constraint->_mixY = from->_mixY;
+		constraint->_mixScaleX = from->_mixScaleX;
+		constraint->_mixScaleY = from->_mixScaleY;
+		constraint->_mixShearY = from->_mixShearY;
+		constraint->_active = from->_active;
+	}
+
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; ++i) {
+		PathConstraint *constraint = _pathConstraints[i], *from = skeleton._pathConstraints[i];
+		constraint->_position = from->_position;
+		constraint->_spacing = from->_spacing;
+		constraint->_mixRotate = from->_mixRotate;
+		constraint->_mixX = from->_mixX;
+		constraint->_mixY = from->_mixY;
+		constraint->_active = from->_active;
+	}
+
+	// The objects have the same offsets in both arenas.
+	_updateCache.setSize(skeleton._updateCache.size(), NULL);
+	for (size_t i = 0, n = _updateCache.size(); i < n; ++i)
+		_updateCache[i] = (Updatable *) (_arena + ((char *) skeleton._updateCache[i] - skeleton._arena));
+	_batchRuns.clearAndAddAll(skeleton._batchRuns);
+	_batchLevels.clearAndAddAll(skeleton._batchLevels);
+	_batchBones.clearAndAddAll(skeleton._batchBones);
+	_batchParents.clearAndAddAll(skeleton._batchParents);
+	_groupOffsets.clearAndAddAll(skeleton._groupOffsets);
+	_groupEntries.clearAndAddAll(skeleton._groupEntries);
+	_dependentOffsets.clearAndAddAll(skeleton._dependentOffsets);
+	_groupDependents.clearAndAddAll(skeleton._groupDependents);
+	_groupDependencyCounts.clearAndAddAll(skeleton._groupDependencyCounts);
+	_incremental = skeleton._incremental;
+	_ikEnabled = skeleton._ikEnabled;
+	_transformEnabled = skeleton._transformEnabled;
+	_pathEnabled = skeleton._pathEnabled;
+	_tracked = false;
 }
 
 void Skeleton::updateCache() {
+	adoptOrSortUpdateCache();
+	updateBatches();
+	_groupOffsets.clear();
+	_tracked = false;
+}
+
+void Skeleton::adoptOrSortUpdateCache() {
+	// The orders of the data's skins are prepared by SkeletonData::prepareUpdateOrders() and only read here, so skeletons
+	// of the same data can be created and updated on several threads. Other skins, e.g. combined at runtime, are sorted.
+	int orderIndex = 0;
+	if (_skin != NULL) {
+		int skinIndex = _data->_skins.indexOf(_skin);
+		orderIndex = skinIndex == -1 ? -1 : skinIndex + 1;
+	}
+	SkeletonData::UpdateOrder *order = NULL;
+	Vector<SkeletonData::UpdateOrder *> &orders = _data->_updateOrders;
+	if (orderIndex != -1 && (size_t) orderIndex < orders.size()) order = orders[orderIndex];
+	if (order != NULL && isUpdateOrderCurrent(*order) && adoptUpdateOrder(*order)) return;
+	sortUpdateCache();
+}
+
+bool Skeleton::isUpdateOrderCurrent(SkeletonData::UpdateOrder &order) {
+	return order._activeBones.size() == _bones.size() && order._ikCount == _ikConstraints.size() &&
+		   order._transformCount == _transformConstraints.size() && order._pathCount == _pathConstraints.size();
+}
+
+bool Skeleton::hasSkinPathAttachments(SkeletonData::UpdateOrder &order) {
+	// A path attachment that is not in the skins, e.g. set at runtime, can require more bones to be sorted.
+	Vector<int> &updateCache = order._updateCache;
+	for (size_t i = 0, n = updateCache.size(); i < n; i++) {
+		if ((updateCache[i] & 3) != SkeletonData::UpdateOrder::UpdatePath) continue;
+		Slot *slot = _pathConstraints[updateCache[i] >> 2]->getTarget();
+		Attachment *attachment = slot->getAttachment();
+		if (attachment == NULL || !attachment->getRTTI().instanceOf(PathAttachment::rtti)) continue;
+		bool found = false;
+		for (size_t ii = 0, nn = order._pathSlots.size(); ii < nn; ii++) {
+			if (order._pathSlots[ii] == slot->getData().getIndex() && order._pathAttachments[ii] == attachment) {
+				found = true;
+				break;
+			}
+		}
+		if (!found) return false;
+	}
+	return true;
+}
+
+bool Skeleton::adoptUpdateOrder(SkeletonData::UpdateOrder &order) {
+	if (!hasSkinPathAttachments(order)) return false;
+
+	Vector<int> &updateCache = order._updateCache;
+	size_t n = updateCache.size();
+	for (size_t i = 0, nn = _bones.size(); i < nn; ++i)
+		_bones[i]->_active = order._activeBones[i];
+	for (size_t i = 0, nn = _ikConstraints.size(); i < nn; ++i)
+		_ikConstraints[i]->_active = false;
+	for (size_t i = 0, nn = _transformConstraints.size(); i < nn; ++i)
+		_transformConstraints[i]->_active = false;
+	for (size_t i = 0, nn = _pathConstraints.size(); i < nn; ++i)
+		_pathConstraints[i]->_active = false;
+
+	_updateCache.setSize(n, NULL);
+	for (size_t i = 0; i < n; i++) {
+		int index = updateCache[i] >> 2;
+		switch (updateCache[i] & 3) {
+			case SkeletonData::UpdateOrder::UpdateBone:
+				_updateCache[i] = _bones[index];
+				break;
+			case SkeletonData::UpdateOrder::UpdateIk:
+				_ikConstraints[index]->_active = true;
+				_updateCache[i] = _ikConstraints[index];
+				break;
+			case SkeletonData::UpdateOrder::UpdateTransform:
+				_transformConstraints[index]->_active = true;
+				_updateCache[i] = _transformConstraints[index];
+				break;
+			default:
+				_pathConstraints[index]->_active = true;
+				_updateCache[i] = _pathConstraints[index];
+		}
+	}
+	return true;
+}
+
+SkeletonData::UpdateOrder *Skeleton::recordUpdateOrder() {
+	SkeletonData::UpdateOrder *order = new (__FILE__, __LINE__) SkeletonData::UpdateOrder();
+	order->_ikCount = _ikConstraints.size();
+	order->_transformCount = _transformConstraints.size();
+	order->_pathCount = _pathConstraints.size();
+
+	order->_activeBones.setSize(_bones.size(), false);
+	for (size_t i = 0, n = _bones.size(); i < n; ++i)
+		order->_activeBones[i] = _bones[i]->_active;
+
+	order->_updateCache.setSize(_updateCache.size(), 0);
+	for (size_t i = 0, n = _updateCache.size(); i < n; i++) {
+		Updatable *updatable = _updateCache[i];
+		int entry;
+		if (updatable->getRTTI().isExactly(Bone::rtti))
+			entry = (((Bone *) updatable)->getData().getIndex() << 2) | SkeletonData::UpdateOrder::UpdateBone;
+		else if (updatable->getRTTI().isExactly(IkConstraint::rtti))
+			entry = (_ikConstraints.indexOf((IkConstraint *) updatable) << 2) | SkeletonData::UpdateOrder::UpdateIk;
+		else if (updatable->getRTTI().isExactly(TransformConstraint::rtti))
+			entry = (_transformConstraints.indexOf((TransformConstraint *) updatable) << 2) |
+					SkeletonData::UpdateOrder::UpdateTransform;
+		else {
+			PathConstraint *constraint = (PathConstraint *) updatable;
+			entry = (_pathConstraints.indexOf(constraint) << 2) | SkeletonData::UpdateOrder::UpdatePath;
+
+			int slotIndex = constraint->getTarget()->getData().getIndex();
+			for (size_t ii = 0, nn = _data->_skins.size(); ii < nn; ii++) {
+				Skin::AttachmentMap::Entries attachments = _data->_skins[ii]->getAttachments();
+				while (attachments.hasNext()) {
+					Skin::AttachmentMap::Entry attachmentEntry = attachments.next();
+					if (attachmentEntry._slotIndex != (size_t) slotIndex) continue;
+					if (!attachmentEntry._attachment->getRTTI().instanceOf(PathAttachment::rtti)) continue;
+					order->_pathSlots.add(slotIndex);
+					order->_pathAttachments.add(attachmentEntry._attachment);
+				}
+			}
+		}
+		order->_updateCache[i] = entry;
+	}
+	return order;
+}
+
+void Skeleton::sortUpdateCache() {
 	_updateCache.clear();
 
 	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
@@ -190,6 +462,316 @@ continue_outer:
 	}
 }
 
+static bool isBatchable(Updatable *updatable) {
+	if (!updatable->getRTTI().isExactly(Bone::rtti)) return false;
+	Bone *bone = (Bone *) updatable;
+	return bone->getParent() != NULL && bone->getData().getTransformMode() == TransformMode_Normal;
+}
+
+void Skeleton::updateBatches() {
+	_batchRuns.clear();
+	_batchLevels.clear();
+	_batchBones.clear();
+	_batchParents.clear();
+
+	// Shorter runs are not worth the gathering.
+	const size_t minRunLength = 4;
+	for (size_t i = 0, n = _updateCache.size(); i < n;) {
+		if (!isBatchable(_updateCache[i])) {
+			i++;
+			continue;
+		}
+		size_t start = i;
+		int minDepth = INT_MAX, maxDepth = 0;
+		for (; i < n && isBatchable(_updateCache[i]); i++) {
+			int depth = 0;
+			for (Bone *parent = ((Bone *) _updateCache[i])->getParent(); parent; parent = parent->getParent())
+				depth++;
+			minDepth = MathUtil::min(minDepth, depth);
+			maxDepth = MathUtil::max(maxDepth, depth);
+		}
+		if (i - start < minRunLength) continue;
+
+		// A parent is at a lower depth than its children, so levels are computed in order of depth.
+		_batchRuns.add(start);
+		_batchRuns.add(i);
+		_batchRuns.add(_batchLevels.size() >> 1);
+		_batchRuns.add(0);
+		for (int depth = minDepth; depth <= maxDepth; depth++) {
+			size_t offset = _batchBones.size();
+			for (size_t ii = start; ii < i; ii++) {
+				Bone *bone = (Bone *) _updateCache[ii];
+				int boneDepth = 0;
+				for (Bone *parent = bone->getParent(); parent; parent = parent->getParent())
+					boneDepth++;
+				if (boneDepth != depth) continue;
+				_batchBones.add(bone->getData().getIndex());
+				_batchParents.add(bone->getParent()->getData().getIndex());
+			}
+			if (_batchBones.size() == offset) continue;
+			_batchLevels.add(offset);
+			_batchLevels.add(_batchBones.size() - offset);
+			_batchRuns[_batchRuns.size() - 1]++;
+		}
+	}
+}
+
+static void addDependency(Vector<int> &dependencies, Vector<int> &marks, int entry, int dependency) {
+	if (dependency < 0 || dependency == entry || marks[dependency] == entry) return;
+	marks[dependency] = entry;
+	dependencies.add(dependency);
+}
+
+static int findRoot(Vector<int> &roots, int group) {
+	while (roots[group] != group)
+		group = roots[group] = roots[roots[group]];
+	return group;
+}
+
+void Skeleton::updateGroups() {
+	size_t boneCount = _bones.size(), cacheCount = _updateCache.size();
+
+	// An update cache entry depends on the last entry before it that changed a bone it reads or changes, and on the
+	// entries since then that read a bone it changes.
+	Vector<int> lastChanged, lastReader, readerEntries, readerNext;
+	lastChanged.setSize(boneCount, -1);
+	lastReader.setSize(boneCount, -1);
+	Vector<int> marks, dependencies, reads, changes;
+	Vector<Attachment *> attachments;
+	marks.setSize(cacheCount, -1);
+	Vector<size_t> dependencyOffsets;
+	dependencyOffsets.ensureCapacity(cacheCount + 1);
+	Vector<int> dependentCounts;
+	dependentCounts.setSize(cacheCount, 0);
+	for (size_t i = 0; i < cacheCount; i++) {
+		Updatable *updatable = _updateCache[i];
+		reads.clear();
+		changes.clear();
+		if (updatable->getRTTI().isExactly(Bone::rtti)) {
+			Bone *bone = (Bone *) updatable;
+			if (bone->_parent) reads.add(bone->_parent->_data.getIndex());
+			changes.add(bone->_data.getIndex());
+		} else {
+			Vector<Bone *> *bones;
+			if (updatable->getRTTI().isExactly(IkConstraint::rtti)) {
+				bones = &((IkConstraint *) updatable)->_bones;
+				reads.add(((IkConstraint *) updatable)->_target->_data.getIndex());
+			} else if (updatable->getRTTI().isExactly(TransformConstraint::rtti)) {
+				bones = &((TransformConstraint *) updatable)->_bones;
+				reads.add(((TransformConstraint *) updatable)->_target->_data.getIndex());
+			} else {
+				PathConstraint *constraint = (PathConstraint *) updatable;
+				bones = &constraint->_bones;
+				Slot *slot = constraint->_target;
+				reads.add(slot->_bone._data.getIndex());
+				// The same path attachments sortPathConstraint() sorted.
+				attachments.clear();
+				for (size_t ii = 0, nn = _data->_skins.size(); ii < nn; ii++)
+					_data->_skins[ii]->findAttachmentsForSlot(slot->_data.getIndex(), attachments);
+				attachments.add(slot->getAttachment());
+				for (size_t ii = 0, nn = attachments.size(); ii < nn; ii++)
+					addPathAttachmentBones(attachments[ii], reads);
+			}
+			for (size_t ii = 0, n = bones->size(); ii < n; ii++) {
+				Bone *bone = (*bones)[ii];
+				if (bone->_parent) reads.add(bone->_parent->_data.getIndex());
+				changes.add(bone->_data.getIndex());
+			}
+		}
+
+		dependencyOffsets.add(dependencies.size());
+		for (size_t ii = 0, n = reads.size(); ii < n; ii++) {
+			int bone = reads[ii];
+			addDependency(dependencies, marks, (int) i, lastChanged[bone]);
+			readerEntries.add((int) i);
+			readerNext.add(lastReader[bone]);
+			lastReader[bone] = (int) readerEntries.size() - 1;
+		}
+		for (size_t ii = 0, n = changes.size(); ii < n; ii++) {
+			int bone = changes[ii];
+			addDependency(dependencies, marks, (int) i, lastChanged[bone]);
+			for (int reader = lastReader[bone]; reader >= 0; reader = readerNext[reader])
+				addDependency(dependencies, marks, (int) i, readerEntries[reader]);
+			lastReader[bone] = -1;
+			lastChanged[bone] = (int) i;
+		}
+	}
+	dependencyOffsets.add(dependencies.size());
+
+	// A dependency is dropped when the entry also depends on a later entry that depends on it, so more entries depend
+	// on a single entry. The ancestors of each entry are kept as bits.
+	size_t words = (cacheCount + 31) >> 5;
+	Vector<unsigned int> ancestors;
+	ancestors.setSize(cacheCount * words, 0);
+	Vector<int> reduced;
+	reduced.ensureCapacity(dependencies.size());
+	for (size_t i = 0; i < cacheCount; i++) {
+		unsigned int *entryAncestors = ancestors.buffer() + i * words;
+		size_t first = dependencyOffsets[i], last = dependencyOffsets[i + 1];
+		for (size_t ii = first; ii < last; ii++) {
+			int dependency = dependencies[ii];
+			unsigned int *dependencyAncestors = ancestors.buffer() + dependency * words;
+			for (size_t word = 0; word < words; word++)
+				entryAncestors[word] |= dependencyAncestors[word];
+			entryAncestors[dependency >> 5] |= 1u << (dependency & 31);
+		}
+		dependencyOffsets[i] = reduced.size();
+		for (size_t ii = first; ii < last; ii++) {
+			int dependency = dependencies[ii];
+			bool implied = false;
+			for (size_t iii = first; iii < last && !implied; iii++)
+				implied = (ancestors[dependencies[iii] * words + (dependency >> 5)] >> (dependency & 31)) & 1;
+			if (implied) continue;
+			reduced.add(dependency);
+			dependentCounts[dependency]++;
+		}
+	}
+	dependencyOffsets[cacheCount] = reduced.size();
+	dependencies.clear();
+	dependencies.addAll(reduced);
+
+	// An entry continues the group of the entry it depends on if it is the only entry depending on that one, so other
+	// groups are only entered at their first entry.
+	Vector<int> groups;
+	groups.setSize(cacheCount, 0);
+	int groupCount = 0;
+	for (size_t i = 0; i < cacheCount; i++) {
+		size_t first = dependencyOffsets[i];
+		if (dependencyOffsets[i + 1] - first == 1 && dependentCounts[dependencies[first]] == 1)
+			groups[i] = groups[dependencies[first]];
+		else
+			groups[i] = groupCount++;
+	}
+
+	// Smaller groups are not worth the scheduling. A small group is merged into the group it depends on if there is only
+	// one, or else into the group that depends on it if there is only one, which cannot create a cycle. The groups of
+	// the merges in a pass are distinct, so the merges do not affect each other.
+	const int minGroupSize = 8;
+	Vector<int> roots, sizes, parents, children;
+	Vector<bool> merging;
+	roots.setSize(groupCount, 0);
+	for (int i = 0; i < groupCount; i++)
+		roots[i] = i;
+	sizes.setSize(groupCount, 0);
+	parents.setSize(groupCount, -1);
+	children.setSize(groupCount, -1);
+	merging.setSize(groupCount, false);
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (int i = 0; i < groupCount; i++) {
+			sizes[i] = 0;
+			parents[i] = -1;
+			children[i] = -1;
+			merging[i] = false;
+		}
+		for (size_t i = 0; i < cacheCount; i++) {
+			int group = findRoot(roots, groups[i]);
+			sizes[group]++;
+			for (size_t ii = dependencyOffsets[i], n = dependencyOffsets[i + 1]; ii < n; ii++) {
+				int parent = findRoot(roots, groups[dependencies[ii]]);
+				if (parent == group) continue;
+				parents[group] = parents[group] == -1 || parents[group] == parent ? parent : -2;
+				children[parent] = children[parent] == -1 || children[parent] == group ? group : -2;
+			}
+		}
+		for (int i = 0; i < groupCount; i++) {
+			if (roots[i] != i || sizes[i] >= minGroupSize || merging[i]) continue;
+			int other = parents[i] >= 0 && !merging[parents[i]] ? parents[i] : children[i];
+			if (other < 0 || merging[other]) continue;
+			roots[i] = other;
+			merging[i] = merging[other] = true;
+			changed = true;
+		}
+	}
+
+	// The groups are numbered by the length of the longest chain of groups they depend on, so each comes after the
+	// groups it depends on.
+	Vector<int> levels;
+	levels.setSize(groupCount, 0);
+	for (int i = 0; i < groupCount; i++)
+		levels[i] = 0;
+	for (size_t i = 0; i < cacheCount; i++)
+		groups[i] = findRoot(roots, groups[i]);
+	int levelCount = 1;
+	for (changed = true; changed;) {
+		changed = false;
+		for (size_t i = 0; i < cacheCount; i++) {
+			int &level = levels[groups[i]];
+			for (size_t ii = dependencyOffsets[i], n = dependencyOffsets[i + 1]; ii < n; ii++) {
+				int parent = groups[dependencies[ii]];
+				if (parent == groups[i] || level > levels[parent]) continue;
+				level = levels[parent] + 1;
+				levelCount = MathUtil::max(levelCount, level + 1);
+				changed = true;
+			}
+		}
+	}
+	Vector<int> numbers;
+	numbers.setSize(groupCount, -1);
+	int count = 0;
+	for (int level = 0; level < levelCount; level++) {
+		for (int i = 0; i < groupCount; i++)
+			if (roots[i] == i && levels[i] == level) numbers[i] = count++;
+	}
+	for (size_t i = 0; i < cacheCount; i++)
+		groups[i] = numbers[groups[i]];
+	groupCount = count;
+
+	_groupOffsets.setSize(groupCount + 1, 0);
+	for (int i = 0; i < groupCount + 1; i++)
+		_groupOffsets[i] = 0;
+	for (size_t i = 0; i < cacheCount; i++)
+		_groupOffsets[groups[i] + 1]++;
+	for (int i = 0; i < groupCount; i++)
+		_groupOffsets[i + 1] += _groupOffsets[i];
+	_groupEntries.setSize(cacheCount, 0);
+	Vector<size_t> next;
+	next.addAll(_groupOffsets);
+	for (size_t i = 0; i < cacheCount; i++)
+		_groupEntries[next[groups[i]]++] = i;
+
+	Vector<int> edges;
+	_groupDependencyCounts.setSize(groupCount, 0);
+	_dependentOffsets.setSize(groupCount + 1, 0);
+	for (int i = 0; i < groupCount + 1; i++)
+		_dependentOffsets[i] = 0;
+	for (int i = 0; i < groupCount; i++) {
+		int mark = -2 - (int) cacheCount - i;
+		_groupDependencyCounts[i] = 0;
+		for (size_t ii = _groupOffsets[i], n = _groupOffsets[i + 1]; ii < n; ii++) {
+			size_t entry = _groupEntries[ii];
+			for (size_t iii = dependencyOffsets[entry], nn = dependencyOffsets[entry + 1]; iii < nn; iii++) {
+				int group = groups[dependencies[iii]];
+				if (group == i || marks[group] == mark) continue;
+				marks[group] = mark;
+				edges.add(group);
+				edges.add(i);
+				_groupDependencyCounts[i]++;
+				_dependentOffsets[group + 1]++;
+			}
+		}
+	}
+	for (int i = 0; i < groupCount; i++)
+		_dependentOffsets[i + 1] += _dependentOffsets[i];
+	_groupDependents.setSize(edges.size() >> 1, 0);
+	next.clear();
+	next.addAll(_dependentOffsets);
+	for (size_t i = 0, n = edges.size(); i < n; i += 2)
+		_groupDependents[next[edges[i]]++] = edges[i + 1];
+}
+
+void Skeleton::addPathAttachmentBones(Attachment *attachment, Vector<int> &bones) {
+	if (attachment == NULL || !attachment->getRTTI().instanceOf(PathAttachment::rtti)) return;
+	Vector<size_t> &pathBones = static_cast<PathAttachment *>(attachment)->getBones();
+	for (size_t i = 0, n = pathBones.size(); i < n;) {
+		size_t nn = pathBones[i++];
+		nn += i;
+		while (i < nn)
+			bones.add((int) pathBones[i++]);
+	}
+}
+
 void Skeleton::printUpdateCache() {
 	for (size_t i = 0; i < _updateCache.size(); i++) {
 		Updatable *updatable = _updateCache[i];
@@ -206,45 +788,319 @@ void Skeleton::printUpdateCache() {
 }
 
 void Skeleton::updateWorldTransform() {
-	for (size_t i = 0, n = _bones.size(); i < n; i++) {
-		Bone *bone = _bones[i];
-		bone->_ax = bone->_x;
-		bone->_ay = bone->_y;
-		bone->_arotation = bone->_rotation;
-		bone->_ascaleX = bone->_scaleX;
-		bone->_ascaleY = bone->_scaleY;
-		bone->_ashearX = bone->_shearX;
-		bone->_ashearY = bone->_shearY;
+	beginUpdateWorldTransform();
+
+	size_t i = 0;
+	for (size_t run = 0, runs = _batchRuns.size(); run < runs; run += 4) {
+		for (size_t start = _batchRuns[run]; i < start; ++i)
+			updateCacheEntry(i);
+		size_t end = _batchRuns[run + 1];
+		if (_incremental) {
+			// A run is batched only when all of its bones are dirty.
+			size_t clean = i;
+			while (clean < end && _dirtyCache[clean])
+				clean++;
+			if (clean < end) {
+				for (; i < end; ++i)
+					updateCacheEntry(i);
+				continue;
+			}
+		}
+		// The levels of a run are consecutive in _batchBones, so the local transforms of a run are computed at once.
+		size_t firstLevel = _batchRuns[run + 2], lastLevel = firstLevel + _batchRuns[run + 3] - 1;
+		size_t runOffset = _batchLevels[firstLevel << 1];
+		_pose.updateLocalTransforms(_batchBones.buffer() + runOffset,
+									_batchLevels[lastLevel << 1] + _batchLevels[(lastLevel << 1) + 1] - runOffset);
+		for (size_t level = firstLevel; level <= lastLevel; level++) {
+			size_t offset = _batchLevels[level << 1];
+			_pose.updateWorldTransforms(_batchBones.buffer() + offset, _batchParents.buffer() + offset,
+										_batchLevels[(level << 1) + 1]);
+		}
+		i = end;
+	}
+	for (size_t n = _updateCache.size(); i < n; ++i) {
+		updateCacheEntry(i);
+	}
+	endUpdateWorldTransform();
+}
+
+void Skeleton::beginUpdateWorldTransform() {
+	_skippedBones = 0;
+	if (_incremental)
+		markDirty();
+	else
+		_pose.setAppliedToLocal(_bones.size());
+}
+
+void Skeleton::updateGroup(size_t group) {
+	for (size_t i = _groupOffsets[group], n = _groupOffsets[group + 1]; i < n; i++)
+		updateCacheEntry(_groupEntries[i]);
+}
+
+void Skeleton::endUpdateWorldTransform() {
+	if (_incremental) _tracked = true;
+}
+
+void Skeleton::updateCacheEntry(size_t index) {
+	if (_incremental && !_dirtyCache[index]) return;
+	Updatable *updatable = _updateCache[index];
+	if ((_ikEnabled && _transformEnabled && _pathEnabled) || isEnabled(updatable)) updatable->update();
+}
+
+bool Skeleton::isEnabled(Updatable *updatable) {
+	const RTTI &rtti = updatable->getRTTI();
+	if (rtti.isExactly(IkConstraint::rtti)) return _ikEnabled;
+	if (rtti.isExactly(TransformConstraint::rtti)) return _transformEnabled;
+	if (rtti.isExactly(PathConstraint::rtti)) return _pathEnabled;
+	return true;
+}
+
+bool Skeleton::markRead(int bone, size_t index) {
+	// A clean bone keeps its transforms from the end of the last update, which a reader only sees in a full update if
+	// no constraint changes the bone after the reader.
+	bool &boneDirty = _dirtyBones[bone];
+	if (boneDirty || _lastConstrained[bone] <= (int) index) return false;
+	boneDirty = true;
+	return true;
+}
+
+bool Skeleton::track(size_t &index, const float *values, size_t count) {
+	if (_trackedState.size() < index + count) _trackedState.setSize(index + count, 0);
+	float *tracked = _trackedState.buffer() + index;
+	index += count;
+	bool changed = false;
+	for (size_t i = 0; i < count; i++) {
+		changed |= tracked[i] != values[i];
+		tracked[i] = values[i];
 	}
+	return changed;
+}
 
-	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
-		_updateCache[i]->update();
+void Skeleton::indexUpdateCache() {
+	size_t boneCount = _bones.size(), cacheCount = _updateCache.size();
+	_trackedState.clear();
+	_cacheBones.setSize(cacheCount, -1);
+	_cacheParents.setSize(cacheCount, -1);
+	_cacheConstraints.clear();
+	_lastConstrained.setSize(boneCount, -1);
+	for (size_t i = 0; i < boneCount; i++)
+		_lastConstrained[i] = -1;
+	for (size_t i = 0; i < cacheCount; i++) {
+		Updatable *updatable = _updateCache[i];
+		Vector<Bone *> *bones;
+		_cacheBones[i] = -1;
+		_cacheParents[i] = -1;
+		if (updatable->getRTTI().isExactly(Bone::rtti)) {
+			Bone *bone = (Bone *) updatable;
+			_cacheBones[i] = bone->_data.getIndex();
+			if (bone->_parent) _cacheParents[i] = bone->_parent->_data.getIndex();
+			continue;
+		} else if (updatable->getRTTI().isExactly(IkConstraint::rtti))
+			bones = &((IkConstraint *) updatable)->_bones;
+		else if (updatable->getRTTI().isExactly(TransformConstraint::rtti))
+			bones = &((TransformConstraint *) updatable)->_bones;
+		else
+			bones = &((PathConstraint *) updatable)->_bones;
+		_cacheConstraints.add(i);
+		for (size_t ii = 0, n = bones->size(); ii < n; ii++)
+			_lastConstrained[(*bones)[ii]->_data.getIndex()] = (int) i;
 	}
 }
 
+void Skeleton::markDirty() {
+	if (!_tracked) indexUpdateCache();
+	size_t boneCount = _bones.size(), cacheCount = _updateCache.size();
+	_dirtyBones.setSize(boneCount, false);
+	_dirtyCache.setSize(cacheCount, false);
+	bool *dirty = _dirtyBones.buffer(), *dirtyCache = _dirtyCache.buffer();
+	int *cacheBones = _cacheBones.buffer(), *cacheParents = _cacheParents.buffer();
+	bool changed = _pose.findLocalChanges(dirty, boneCount) > 0;
+
+	size_t index = 0;
+	float transform[] = {_x, _y, _scaleX, _scaleY};
+	if (track(index, transform, 4) || !_tracked) {
+		for (size_t i = 0; i < boneCount; i++)
+			dirty[i] = true;
+		changed = true;
+	}
+	for (size_t i = 0; i < cacheCount; i++)
+		dirtyCache[i] = false;
+	for (size_t i = 0, n = _cacheConstraints.size(); i < n; i++) {
+		size_t entry = _cacheConstraints[i];
+		Updatable *updatable = _updateCache[entry];
+		bool constraintChanged = !_tracked;
+		if (updatable->getRTTI().isExactly(IkConstraint::rtti)) {
+			IkConstraint *constraint = (IkConstraint *) updatable;
+			float values[] = {constraint->_mix, constraint->_softness, (float) constraint->_bendDirection,
+							  (float) constraint->_compress, (float) constraint->_stretch};
+			constraintChanged |= track(index, values, 5);
+		} else if (updatable->getRTTI().isExactly(TransformConstraint::rtti)) {
+			TransformConstraint *constraint = (TransformConstraint *) updatable;
+			float values[] = {constraint->_mixRotate, constraint->_mixX, constraint->_mixY,
+							  constraint->_mixScaleX, constraint->_mixScaleY, constraint->_mixShearY};
+			constraintChanged |= track(index, values, 6);
+		} else {
+			// The path can change with the target slot's attachment or deform.
+			constraintChanged = true;
+		}
+		dirtyCache[entry] = constraintChanged;
+		changed |= constraintChanged;
+	}
+	if (!changed) {
+		for (size_t i = 0; i < cacheCount; i++)
+			_skippedBones += cacheBones[i] >= 0;
+		return;
+	}
+
+	// Bones are dirty when their local transform or their parent changed. Constraints are dirty when their mix values,
+	// target or bones changed and make their bones dirty. A constraint can make bones dirty that come before it in the
+	// update cache, so repeat until nothing changes.
+	do {
+		changed = false;
+		for (size_t i = 0; i < cacheCount; i++) {
+			int parent = cacheParents[i];
+			if (parent >= 0) {
+				bool &boneDirty = dirty[cacheBones[i]];
+				boneDirty |= dirty[parent];
+				if (boneDirty) changed |= markRead(parent, i);
+				continue;
+			}
+			if (cacheBones[i] >= 0) continue;
+
+			Updatable *updatable = _updateCache[i];
+			Vector<Bone *> *bones;
+			Bone *target;
+			if (updatable->getRTTI().isExactly(IkConstraint::rtti)) {
+				bones = &((IkConstraint *) updatable)->_bones;
+				target = ((IkConstraint *) updatable)->_target;
+			} else if (updatable->getRTTI().isExactly(TransformConstraint::rtti)) {
+				bones = &((TransformConstraint *) updatable)->_bones;
+				target = ((TransformConstraint *) updatable)->_target;
+			} else {
+				PathConstraint *constraint = (PathConstraint *) updatable;
+				bones = &constraint->_bones;
+				target = &constraint->_target->getBone();
+				Attachment *attachment = constraint->_target->getAttachment();
+				if (attachment && attachment->getRTTI().isExactly(PathAttachment::rtti)) {
+					Vector<size_t> &pathBones = ((PathAttachment *) attachment)->getBones();
+					for (size_t ii = 0, n = pathBones.size(); ii < n;) {
+						size_t nn = pathBones[ii++];
+						nn += ii;
+						while (ii < nn)
+							changed |= markRead((int) pathBones[ii++], i);
+					}
+				}
+			}
+			bool constraintDirty = dirtyCache[i] || dirty[target->_data.getIndex()];
+			for (size_t ii = 0, n = bones->size(); ii < n && !constraintDirty; ii++)
+				constraintDirty = dirty[(*bones)[ii]->_data.getIndex()];
+			if (!constraintDirty) continue;
+			dirtyCache[i] = true;
+			changed |= markRead(target->_data.getIndex(), i);
+			for (size_t ii = 0, n = bones->size(); ii < n; ii++) {
+				Bone *bone = (*bones)[ii];
+				bool &boneDirty = dirty[bone->_data.getIndex()];
+				if (!boneDirty) changed = boneDirty = true;
+				if (bone->_parent) changed |= markRead(bone->_parent->_data.getIndex(), i);
+			}
+		}
+	} while (changed);
+
+	size_t dirtyCount = 0;
+	for (size_t i = 0; i < boneCount; i++)
+		dirtyCount += dirty[i];
+	for (size_t i = 0; i < cacheCount; i++) {
+		if (cacheBones[i] < 0) continue;
+		dirtyCache[i] = dirty[cacheBones[i]];
+		_skippedBones += !dirtyCache[i];
+	}
+	if (dirtyCount == boneCount)
+		_pose.setAppliedToLocal(boneCount);
+	else
+		_pose.setAppliedToLocal(dirty, boneCount);
+}
+
 void Skeleton::updateWorldTransform(Bone *parent) {
 	// Apply the parent bone transform to the root bone. The root bone always inherits scale, rotation and reflection.
 	Bone &rootBone = *getRootBone();
-	float pa = parent->_a, pb = parent->_b, pc = parent->_c, pd = parent->_d;
-	rootBone._worldX = pa * _x + pb * _y + parent->_worldX;
-	rootBone._worldY = pc * _x + pd * _y + parent->_worldY;
-
-	float rotationY = rootBone._rotation + 90 + rootBone._shearY;
-	float la = MathUtil::cosDeg(rootBone._rotation + rootBone._shearX) * rootBone._scaleX;
-	float lb = MathUtil::cosDeg(rotationY) * rootBone._scaleY;
-	float lc = MathUtil::sinDeg(rootBone._rotation + rootBone._shearX) * rootBone._scaleX;
-	float ld = MathUtil::sinDeg(rotationY) * rootBone._scaleY;
-	rootBone._a = (pa * la + pb * lc) * _scaleX;
-	rootBone._b = (pa * lb + pb * ld) * _scaleX;
-	rootBone._c = (pc * la + pd * lc) * _scaleY;
-	rootBone._d = (pc * lb + pd * ld) * _scaleY;
+	float pa = parent->_a(), pb = parent->_b(), pc = parent->_c(), pd = parent->_d();
+	rootBone._worldX() = pa * _x + pb * _y + parent->_worldX();
+	rootBone._worldY() = pc * _x + pd * _y + parent->_worldY();
+
+	float sinX, cosX, sinY, cosY;
+	MathUtil::sinCosDeg(rootBone._rotation() + rootBone._shearX(), sinX, cosX);
+	MathUtil::sinCosDeg(rootBone._rotation() + 90 + rootBone._shearY(), sinY, cosY);
+	float la = cosX * rootBone._scaleX();
+	float lb = cosY * rootBone._scaleY();
+	float lc = sinX * rootBone._scaleX();
+	float ld = sinY * rootBone._scaleY();
+	rootBone._a() = (pa * la + pb * lc) * _scaleX;
+	rootBone._b() = (pa * lb + pb * ld) * _scaleX;
+	rootBone._c() = (pc * la + pd * lc) * _scaleY;
+	rootBone._d() = (pc * lb + pd * ld) * _scaleY;
 
 	// Update everything except root bone.
 	Bone *rb = getRootBone();
+	bool enabled = _ikEnabled && _transformEnabled && _pathEnabled;
 	for (size_t i = 0, n = _updateCache.size(); i < n; i++) {
 		Updatable *updatable = _updateCache[i];
-		if (updatable != rb) updatable->update();
+		if (updatable != rb && (enabled || isEnabled(updatable))) updatable->update();
 	}
+	_tracked = false;
+}
+
+void Skeleton::setIncrementalUpdate(bool incremental) {
+	_incremental = incremental;
+	_tracked = false;
+}
+
+bool Skeleton::isIncrementalUpdate() {
+	return _incremental;
+}
+
+void Skeleton::setIkConstraintsEnabled(bool enabled) {
+	_ikEnabled = enabled;
+	_tracked = false;
+}
+
+bool Skeleton::isIkConstraintsEnabled() {
+	return _ikEnabled;
+}
+
+void Skeleton::setTransformConstraintsEnabled(bool enabled) {
+	_transformEnabled = enabled;
+	_tracked = false;
+}
+
+bool Skeleton::isTransformConstraintsEnabled() {
+	return _transformEnabled;
+}
+
+void Skeleton::setPathConstraintsEnabled(bool enabled) {
+	_pathEnabled = enabled;
+	_tracked = false;
+}
+
+bool Skeleton::isPathConstraintsEnabled() {
+	return _pathEnabled;
+}
+
+size_t Skeleton::getSkippedBoneCount() {
+	return _skippedBones;
+}
+
+size_t Skeleton::getUpdateGroupCount() {
+	if (_groupOffsets.size() == 0) updateGroups();
+	return _groupOffsets.size() - 1;
+}
+
+size_t Skeleton::getUpdateGroupDependencyCount(size_t group) {
+	return _groupDependencyCounts[group];
+}
+
+int *Skeleton::getUpdateGroupDependents(size_t group, size_t &count) {
+	count = _dependentOffsets[group + 1] - _dependentOffsets[group];
+	return _groupDependents.buffer() + _dependentOffsets[group];
 }
 
 void Skeleton::setToSetupPose() {
@@ -482,6 +1338,10 @@ Vector<Bone *> &Skeleton::getBones() {
 	return _bones;
 }
 
+SkeletonPose &Skeleton::getPose() {
+	return _pose;
+}
+
 Vector<Updatable *> &Skeleton::getUpdateCacheList() {
 	return _updateCache;
 }
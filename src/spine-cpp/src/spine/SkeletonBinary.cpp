@@ -343,6 +343,9 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 		skeletonData->_animations[i] = animation;
 	}
 
+	skeletonData->indexProperties();
+	skeletonData->prepareUpdateOrders();
+
 	delete input;
 	return skeletonData;
 }
@@ -691,6 +694,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			}
 			readVertices(input, clip->getVertices(), clip->getBones(), vertexCount);
 			clip->setWorldVerticesLength(vertexCount << 1);
+			clip->updateConvexPolygons();
 			clip->_endSlot = skeletonData->_slots[endSlotIndex];
 			if (nonessential) {
 				readColor(input, clip->getColor());
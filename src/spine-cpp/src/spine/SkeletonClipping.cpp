@@ -29,7 +29,9 @@
 
 #include <spine/SkeletonClipping.h>
 
+#include <spine/Bone.h>
 #include <spine/ClippingAttachment.h>
+#include <spine/ContainerUtil.h>
 #include <spine/Slot.h>
 
 using namespace spine;
@@ -41,6 +43,10 @@ SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
 	_clippedUVs.ensureCapacity(128);
 }
 
+SkeletonClipping::~SkeletonClipping() {
+	ContainerUtil::cleanUpVectorOfPointers(_worldPolygonsStorage);
+}
+
 size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	if (_clipAttachment != NULL) {
 		return 0;
@@ -48,6 +54,33 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 
 	_clipAttachment = clip;
 
+	// Unweighted, undeformed polygons only need their cached decomposition moved to the bone
+	Vector<Vector<float> *> &convexPolygons = clip->getConvexPolygons();
+	if (convexPolygons.size() > 0 && slot.getDeform().size() == 0) {
+		Bone &bone = slot.getBone();
+		float x = bone.getWorldX(), y = bone.getWorldY();
+		float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
+		_worldPolygons.clear();
+		for (size_t i = 0; i < convexPolygons.size(); ++i) {
+			if (i == _worldPolygonsStorage.size()) _worldPolygonsStorage.add(new (__FILE__, __LINE__) Vector<float>());
+			Vector<float> &local = *convexPolygons[i];
+			Vector<float> &polygon = *_worldPolygonsStorage[i];
+			polygon.setSize(local.size(), 0);
+			for (size_t ii = 0; ii < local.size(); ii += 2) {
+				float vx = local[ii], vy = local[ii + 1];
+				polygon[ii] = vx * a + vy * b + x;
+				polygon[ii + 1] = vx * c + vy * d + y;
+			}
+			// The bone may mirror the polygon
+			makeClockwise(polygon);
+			polygon.add(polygon[0]);
+			polygon.add(polygon[1]);
+			_worldPolygons.add(&polygon);
+		}
+		_clippingPolygons = &_worldPolygons;
+		return _worldPolygons.size();
+	}
+
 	int n = (int) clip->getWorldVerticesLength();
 	_clippingPolygon.setSize(n, 0);
 	clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
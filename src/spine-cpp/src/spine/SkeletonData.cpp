@@ -34,8 +34,10 @@
 #include <spine/EventData.h>
 #include <spine/IkConstraintData.h>
 #include <spine/PathConstraintData.h>
+#include <spine/Skeleton.h>
 #include <spine/Skin.h>
 #include <spine/SlotData.h>
+#include <spine/Timeline.h>
 #include <spine/TransformConstraintData.h>
 
 #include <spine/ContainerUtil.h>
@@ -50,6 +52,7 @@ SkeletonData::SkeletonData() : _name(),
 							   _height(0),
 							   _version(),
 							   _hash(),
+							   _propertyCount(0),
 							   _fps(0),
 							   _imagesPath() {
 }
@@ -66,6 +69,7 @@ SkeletonData::~SkeletonData() {
 	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
+	ContainerUtil::cleanUpVectorOfPointers(_updateOrders);
 	for (size_t i = 0; i < _strings.size(); i++) {
 		SpineExtension::free(_strings[i], __FILE__, __LINE__);
 	}
@@ -223,3 +227,55 @@ float SkeletonData::getFps() {
 void SkeletonData::setFps(float inValue) {
 	_fps = inValue;
 }
+
+void SkeletonData::indexProperties() {
+	HashMap<PropertyId, int> indices;
+	int count = 0;
+	for (size_t i = 0, n = _animations.size(); i < n; i++) {
+		Vector<Timeline *> &timelines = _animations[i]->getTimelines();
+		for (size_t ii = 0, nn = timelines.size(); ii < nn; ii++) {
+			Vector<PropertyId> &ids = timelines[ii]->getPropertyIds();
+			Vector<int> &timelineIndices = timelines[ii]->getPropertyIndices();
+			timelineIndices.setSize(ids.size(), 0);
+			for (size_t iii = 0, nnn = ids.size(); iii < nnn; iii++) {
+				int index = indices.get(ids[iii], -1);
+				if (index == -1) {
+					index = count++;
+					indices.put(ids[iii], index);
+				}
+				timelineIndices[iii] = index;
+			}
+		}
+	}
+	_propertyCount = count;
+
+	for (size_t i = 0, n = _animations.size(); i < n; i++)
+		_animations[i]->indexProperties(this, count);
+}
+
+int SkeletonData::getPropertyCount() {
+	return _propertyCount;
+}
+
+void SkeletonData::prepareUpdateOrders() {
+	clearUpdateOrders();
+
+	// The skeletons sort their update caches while there are no orders.
+	Vector<UpdateOrder *> orders;
+	orders.setSize(_skins.size() + 1, NULL);
+	for (size_t i = 0, n = orders.size(); i < n; i++) {
+		Skeleton skeleton(this);
+		if (i > 0) skeleton.setSkin(_skins[i - 1]);
+		UpdateOrder *order = skeleton.recordUpdateOrder();
+		if (!skeleton.hasSkinPathAttachments(*order)) {
+			delete order;
+			order = NULL;
+		}
+		orders[i] = order;
+	}
+	_updateOrders.clearAndAddAll(orders);
+}
+
+void SkeletonData::clearUpdateOrders() {
+	ContainerUtil::cleanUpVectorOfPointers(_updateOrders);
+}
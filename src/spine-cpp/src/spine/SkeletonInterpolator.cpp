@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonInterpolator.h>
+
+#include <spine/AnimationState.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonPose.h>
+
+#include <string.h>
+
+using namespace spine;
+
+// The world transform components are adjacent in the pose, from PoseComponent_A to PoseComponent_WorldY.
+static const size_t WorldComponentCount = PoseComponent_Count - PoseComponent_A;
+
+SkeletonInterpolator::SkeletonInterpolator(Skeleton &skeleton, AnimationState *state, int interval, int phase) : _skeleton(skeleton),
+																												 _state(state),
+																												 _interval(1),
+																												 _phase(0),
+																												 _frame(0),
+																												 _elapsed(0),
+																												 _evaluate(true),
+																												 _valid(false) {
+	setInterval(interval, phase);
+}
+
+bool SkeletonInterpolator::beginFrame() {
+	_evaluate = !_valid || _interval <= 1 || _frame == _phase || (_state && _state->isApplyRequired());
+	if (_evaluate && _valid && _skeleton.isIncrementalUpdate()) {
+		// An incremental update starts from the world transforms of the last evaluation, not the interpolated ones
+		memcpy(_skeleton.getPose().getComponent(PoseComponent_A), _to.buffer(), _to.size() * sizeof(float));
+	}
+	return _evaluate;
+}
+
+void SkeletonInterpolator::endFrame() {
+	_frame = (_frame + 1) % _interval;
+	if (_interval <= 1) {
+		_valid = false;
+		return;
+	}
+
+	SkeletonPose &pose = _skeleton.getPose();
+	float *world = pose.getComponent(PoseComponent_A);
+	size_t count = WorldComponentCount * pose.getStride();
+	if (_evaluate) {
+		if (!_valid) {
+			_to.setSize(count, 0);
+			memcpy(_to.buffer(), world, count * sizeof(float));
+			_valid = true;
+		}
+		_from.setSize(count, 0);
+		memcpy(_from.buffer(), _to.buffer(), count * sizeof(float));
+		memcpy(_to.buffer(), world, count * sizeof(float));
+		_elapsed = 0;
+	} else if (_elapsed < _interval - 1)
+		_elapsed++;
+
+	// Advance by an interval's share each frame, reaching the last evaluation on the frame before the next one
+	float alpha = (float) (_elapsed + 1) / _interval;
+	const float *from = _from.buffer(), *to = _to.buffer();
+	for (size_t i = 0; i < count; ++i)
+		world[i] = from[i] + (to[i] - from[i]) * alpha;
+}
+
+void SkeletonInterpolator::reset() {
+	_valid = false;
+}
+
+void SkeletonInterpolator::setInterval(int interval, int phase) {
+	_interval = interval < 1 ? 1 : interval;
+	_phase = phase % _interval;
+	if (_phase < 0) _phase += _interval;
+	_frame %= _interval;
+	_valid = false;
+}
+
+int SkeletonInterpolator::getInterval() {
+	return _interval;
+}
+
+int SkeletonInterpolator::getPhase() {
+	return _phase;
+}
+
+Skeleton &SkeletonInterpolator::getSkeleton() {
+	return _skeleton;
+}
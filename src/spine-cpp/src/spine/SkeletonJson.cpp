@@ -618,7 +618,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 
 									if (mesh->_region != NULL) mesh->updateRegion();
 
-									mesh->_hullLength = Json::getInt(attachmentMap, "hull", 0);
+									mesh->_hullLength = Json::getInt(attachmentMap, "hull", 0) << 1;
 
 									entry = Json::getItem(attachmentMap, "edges");
 									if (entry) {
@@ -699,6 +699,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 								if (end) clip->_endSlot = skeletonData->findSlot(end);
 								vertexCount = Json::getInt(attachmentMap, "vertexCount", 0) << 1;
 								readVertices(attachmentMap, clip, vertexCount);
+								clip->updateConvexPolygons();
 								color = Json::getString(attachmentMap, "color", NULL);
 								if (color) toColor(clip->getColor(), color, true);
 								_attachmentLoader->configureAttachment(attachment);
@@ -778,6 +779,9 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 		}
 	}
 
+	skeletonData->indexProperties();
+	skeletonData->prepareUpdateOrders();
+
 	delete root;
 
 	return skeletonData;
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonLod.h>
+
+#include <spine/AnimationState.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonBounds.h>
+#include <spine/SkeletonRenderer.h>
+#include <spine/Slot.h>
+
+#include <float.h>
+
+using namespace spine;
+
+SkeletonLod::SkeletonLod() {
+	addLevel(FLT_MAX, 0, 0);
+}
+
+void SkeletonLod::addLevel(float size, int disabledFeatures, float minTrackAlpha) {
+	assert(_sizes.size() == 0 || size <= _sizes[_sizes.size() - 1]);
+	_sizes.add(size);
+	_disabledFeatures.add(disabledFeatures);
+	_minTrackAlphas.add(minTrackAlpha);
+}
+
+size_t SkeletonLod::getLevelCount() {
+	return _sizes.size();
+}
+
+float SkeletonLod::getSize(size_t level) {
+	return _sizes[level];
+}
+
+int SkeletonLod::getDisabledFeatures(size_t level) {
+	return _disabledFeatures[level];
+}
+
+float SkeletonLod::getMinTrackAlpha(size_t level) {
+	return _minTrackAlphas[level];
+}
+
+size_t SkeletonLod::getLevel(float size) {
+	size_t level = 0;
+	for (size_t i = 1, n = _sizes.size(); i < n && size < _sizes[i]; ++i)
+		level = i;
+	return level;
+}
+
+size_t SkeletonLod::getLevel(SkeletonBounds &bounds, float scale) {
+	float width = bounds.getWidth(), height = bounds.getHeight();
+	return getLevel((width > height ? width : height) * scale);
+}
+
+void SkeletonLod::apply(size_t level, Skeleton &skeleton, AnimationState *state, SkeletonRenderer *renderer) {
+	int disabled = _disabledFeatures[level];
+	skeleton.setIkConstraintsEnabled((disabled & LodFeature_IkConstraints) == 0);
+	skeleton.setTransformConstraintsEnabled((disabled & LodFeature_TransformConstraints) == 0);
+	skeleton.setPathConstraintsEnabled((disabled & LodFeature_PathConstraints) == 0);
+	if (state) {
+		state->setMinTrackAlpha(_minTrackAlphas[level]);
+		bool deform = (disabled & LodFeature_DeformTimelines) == 0;
+		if (!deform && state->isDeformTimelinesEnabled()) {
+			Vector<Slot *> &slots = skeleton.getSlots();
+			for (size_t i = 0, n = slots.size(); i < n; ++i)
+				slots[i]->getDeform().clear();
+		}
+		state->setDeformTimelinesEnabled(deform);
+	}
+	if (renderer) renderer->setSimplifyMeshes((disabled & LodFeature_Meshes) != 0);
+}
@@ -0,0 +1,219 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonPose.h>
+
+#include <spine/Extension.h>
+#include <spine/MathUtil.h>
+#include <spine/SimdUtil.h>
+
+#include <assert.h>
+#include <string.h>
+
+using namespace spine;
+
+SkeletonPose::SkeletonPose(size_t boneCount) : _buffer(NULL), _lastLocal(NULL), _boneCount(boneCount), _stride((boneCount + 7) & ~(size_t) 7) {
+	if (_stride > 0) _buffer = SpineExtension::calloc<float>(_stride * PoseComponent_Count, __FILE__, __LINE__);
+}
+
+SkeletonPose::~SkeletonPose() {
+	if (_buffer) SpineExtension::free(_buffer, __FILE__, __LINE__);
+	if (_lastLocal) SpineExtension::free(_lastLocal, __FILE__, __LINE__);
+}
+
+size_t SkeletonPose::getBoneCount() {
+	return _boneCount;
+}
+
+size_t SkeletonPose::getStride() {
+	return _stride;
+}
+
+void SkeletonPose::set(SkeletonPose &pose) {
+	assert(pose._boneCount == _boneCount);
+	if (_buffer) memcpy(_buffer, pose._buffer, _stride * PoseComponent_Count * sizeof(float));
+}
+
+void SkeletonPose::setAppliedToLocal(size_t count) {
+	assert(count <= _boneCount);
+	for (int i = 0; i < 7; i++)
+		memcpy(getComponent((PoseComponent) (PoseComponent_AX + i)), getComponent((PoseComponent) (PoseComponent_X + i)),
+			   count * sizeof(float));
+}
+
+void SkeletonPose::setAppliedToLocal(const bool *bones, size_t count) {
+	assert(count <= _boneCount);
+	const float *local = getComponent(PoseComponent_X);
+	float *applied = getComponent(PoseComponent_AX);
+	size_t stride = _stride, i = 0;
+#ifdef SPINE_SIMD_WIDTH
+	const int W = SPINE_SIMD_WIDTH;
+	float flags[W];
+	for (; i + W <= count; i += W) {
+		for (int j = 0; j < W; j++)
+			flags[j] = bones[i + j];
+		SimdMask copy = simdEqual(simdLoad(flags), simdSet(1));
+		for (size_t ii = i, n = stride * 7; ii < n; ii += stride)
+			simdStore(applied + ii, simdSelect(copy, simdLoad(local + ii), simdLoad(applied + ii)));
+	}
+#endif
+	for (; i < count; i++) {
+		if (!bones[i]) continue;
+		for (size_t ii = i, n = stride * 7; ii < n; ii += stride)
+			applied[ii] = local[ii];
+	}
+}
+
+size_t SkeletonPose::findLocalChanges(bool *changed, size_t count) {
+	assert(count <= _boneCount);
+	const float *local = getComponent(PoseComponent_X);
+	size_t stride = _stride, changedCount = 0, i = 0;
+	if (!_lastLocal) {
+		_lastLocal = SpineExtension::alloc<float>(stride * 7, __FILE__, __LINE__);
+		for (; i < count; i++)
+			changed[i] = true;
+		changedCount = count;
+	}
+	// The local components are the first 7, so a bone's components are stride apart in one array.
+	const float *last = _lastLocal;
+#ifdef SPINE_SIMD_WIDTH
+	const int W = SPINE_SIMD_WIDTH;
+	float differences[W];
+	for (; i + W <= count; i += W) {
+		SimdFloat zero = simdSet(0), one = simdSet(1), sum = zero;
+		for (size_t ii = i, n = stride * 7; ii < n; ii += stride)
+			sum = simdAdd(sum, simdSelect(simdEqual(simdLoad(local + ii), simdLoad(last + ii)), zero, one));
+		simdStore(differences, sum);
+		for (int j = 0; j < W; j++) {
+			changed[i + j] = differences[j] != 0;
+			changedCount += differences[j] != 0;
+		}
+	}
+#endif
+	for (; i < count; i++) {
+		bool differs = false;
+		for (size_t ii = i, n = stride * 7; ii < n; ii += stride)
+			differs |= local[ii] != last[ii];
+		changed[i] = differs;
+		changedCount += differs;
+	}
+	memcpy(_lastLocal, local, stride * 7 * sizeof(float));
+	return changedCount;
+}
+
+void SkeletonPose::updateLocalTransforms(const int *bones, size_t count) {
+	float *rotation = getComponent(PoseComponent_ARotation);
+	float *scaleX = getComponent(PoseComponent_AScaleX), *scaleY = getComponent(PoseComponent_AScaleY);
+	float *shearX = getComponent(PoseComponent_AShearX), *shearY = getComponent(PoseComponent_AShearY);
+	float *a = getComponent(PoseComponent_A), *b = getComponent(PoseComponent_B);
+	float *c = getComponent(PoseComponent_C), *d = getComponent(PoseComponent_D);
+
+	// The angles of a block of bones, X rotations first, then Y rotations.
+	const size_t blockSize = 64;
+	float angles[blockSize * 2], sines[blockSize * 2], cosines[blockSize * 2];
+	for (size_t start = 0; start < count; start += blockSize) {
+		const int *blockBones = bones + start;
+		size_t n = MathUtil::min(blockSize, count - start);
+		for (size_t i = 0; i < n; i++) {
+			int bone = blockBones[i];
+			angles[i] = rotation[bone] + shearX[bone];
+			angles[n + i] = rotation[bone] + 90 + shearY[bone];
+		}
+		MathUtil::sinCosDeg(angles, sines, cosines, n * 2);
+		for (size_t i = 0; i < n; i++) {
+			int bone = blockBones[i];
+			a[bone] = cosines[i] * scaleX[bone];
+			b[bone] = cosines[n + i] * scaleY[bone];
+			c[bone] = sines[i] * scaleX[bone];
+			d[bone] = sines[n + i] * scaleY[bone];
+		}
+	}
+}
+
+void SkeletonPose::updateWorldTransforms(const int *bones, const int *parents, size_t count) {
+	float *x = getComponent(PoseComponent_AX), *y = getComponent(PoseComponent_AY);
+	float *a = getComponent(PoseComponent_A), *b = getComponent(PoseComponent_B);
+	float *c = getComponent(PoseComponent_C), *d = getComponent(PoseComponent_D);
+	float *worldX = getComponent(PoseComponent_WorldX), *worldY = getComponent(PoseComponent_WorldY);
+
+	size_t i = 0;
+#ifdef SPINE_SIMD_WIDTH
+	const int W = SPINE_SIMD_WIDTH;
+	float lx[W], ly[W], la[W], lb[W], lc[W], ld[W], pa[W], pb[W], pc[W], pd[W], pwx[W], pwy[W];
+	for (; i + W <= count; i += W) {
+		for (int j = 0; j < W; j++) {
+			int bone = bones[i + j], parent = parents[i + j];
+			lx[j] = x[bone];
+			ly[j] = y[bone];
+			la[j] = a[bone];
+			lb[j] = b[bone];
+			lc[j] = c[bone];
+			ld[j] = d[bone];
+			pa[j] = a[parent];
+			pb[j] = b[parent];
+			pc[j] = c[parent];
+			pd[j] = d[parent];
+			pwx[j] = worldX[parent];
+			pwy[j] = worldY[parent];
+		}
+
+		SimdFloat vx = simdLoad(lx), vy = simdLoad(ly);
+		SimdFloat vla = simdLoad(la), vlb = simdLoad(lb), vlc = simdLoad(lc), vld = simdLoad(ld);
+		SimdFloat vpa = simdLoad(pa), vpb = simdLoad(pb), vpc = simdLoad(pc), vpd = simdLoad(pd);
+		simdStore(pwx, simdAdd(simdAdd(simdMul(vpa, vx), simdMul(vpb, vy)), simdLoad(pwx)));
+		simdStore(pwy, simdAdd(simdAdd(simdMul(vpc, vx), simdMul(vpd, vy)), simdLoad(pwy)));
+		simdStore(la, simdAdd(simdMul(vpa, vla), simdMul(vpb, vlc)));
+		simdStore(lb, simdAdd(simdMul(vpa, vlb), simdMul(vpb, vld)));
+		simdStore(lc, simdAdd(simdMul(vpc, vla), simdMul(vpd, vlc)));
+		simdStore(ld, simdAdd(simdMul(vpc, vlb), simdMul(vpd, vld)));
+
+		for (int j = 0; j < W; j++) {
+			int bone = bones[i + j];
+			worldX[bone] = pwx[j];
+			worldY[bone] = pwy[j];
+			a[bone] = la[j];
+			b[bone] = lb[j];
+			c[bone] = lc[j];
+			d[bone] = ld[j];
+		}
+	}
+#endif
+
+	for (; i < count; i++) {
+		int bone = bones[i], parent = parents[i];
+		float la = a[bone], lb = b[bone], lc = c[bone], ld = d[bone];
+		float pa = a[parent], pb = b[parent], pc = c[parent], pd = d[parent];
+		worldX[bone] = pa * x[bone] + pb * y[bone] + worldX[parent];
+		worldY[bone] = pc * x[bone] + pd * y[bone] + worldY[parent];
+		a[bone] = pa * la + pb * lc;
+		b[bone] = pa * lb + pb * ld;
+		c[bone] = pc * la + pd * lc;
+		d[bone] = pc * lb + pd * ld;
+	}
+}
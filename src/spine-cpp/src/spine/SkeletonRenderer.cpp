@@ -0,0 +1,214 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonRenderer.h>
+
+#include <spine/Atlas.h>
+#include <spine/Bone.h>
+#include <spine/ClippingAttachment.h>
+#include <spine/MeshAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+
+// Indices are unsigned shorts, a command never spans more vertices than this
+#define SPINE_COMMAND_VERTEX_COUNT_MAX 65535
+
+using namespace spine;
+
+SkeletonRenderer::SkeletonRenderer() : _simplifyMeshes(false) {
+	_worldVertices.ensureCapacity(1000);
+	_quadIndices.add(0);
+	_quadIndices.add(1);
+	_quadIndices.add(2);
+	_quadIndices.add(2);
+	_quadIndices.add(3);
+	_quadIndices.add(0);
+}
+
+SkeletonRenderer::~SkeletonRenderer() {
+}
+
+void SkeletonRenderer::render(Skeleton &skeleton) {
+	// Early out if skeleton is invisible
+	Color &skeletonColor = skeleton.getColor();
+	if (skeletonColor.a == 0) return;
+
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0, n = drawOrder.size(); i < n; ++i) {
+		Slot &slot = *drawOrder[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment) continue;
+
+		// Inactive bones belong to a skin that is not shown
+		if (!slot.getBone().isActive()) {
+			_clipper.clipEnd(slot);
+			continue;
+		}
+
+		Vector<float> *vertices = &_worldVertices;
+		size_t verticesCount;
+		Vector<float> *uvs;
+		Vector<unsigned short> *indices;
+		Color *attachmentColor;
+		void *texture;
+
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			RegionAttachment *regionAttachment = static_cast<RegionAttachment *>(attachment);
+			attachmentColor = &regionAttachment->getColor();
+			if (attachmentColor->a == 0) {
+				_clipper.clipEnd(slot);
+				continue;
+			}
+
+			_worldVertices.setSize(8, 0);
+			regionAttachment->computeWorldVertices(slot, _worldVertices, 0, 2);
+			verticesCount = 4;
+			uvs = &regionAttachment->getUVs();
+			indices = &_quadIndices;
+			texture = ((AtlasRegion *) regionAttachment->getRendererObject())->page->getRendererObject();
+		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+			attachmentColor = &mesh->getColor();
+			if (attachmentColor->a == 0) {
+				_clipper.clipEnd(slot);
+				continue;
+			}
+
+			// The hull vertices come first, so their uvs are the start of the mesh's uvs
+			size_t verticesLength = mesh->getWorldVerticesLength(), hullLength = (size_t) mesh->getHullLength();
+			bool simplify = _simplifyMeshes && hullLength >= 6 && hullLength < verticesLength;
+			if (simplify) verticesLength = hullLength;
+			_worldVertices.setSize(verticesLength, 0);
+			mesh->computeWorldVertices(slot, 0, verticesLength, _worldVertices, 0, 2);
+			verticesCount = verticesLength >> 1;
+			uvs = &mesh->getUVs();
+			indices = simplify ? &mesh->getHullTriangles() : &mesh->getTriangles();
+			texture = ((AtlasRegion *) mesh->getRendererObject())->page->getRendererObject();
+		} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+			_clipper.clipStart(slot, static_cast<ClippingAttachment *>(attachment));
+			continue;
+		} else
+			continue;
+
+		if (_clipper.isClipping()) {
+			_clipper.clipTriangles(_worldVertices, *indices, *uvs, 2);
+			vertices = &_clipper.getClippedVertices();
+			verticesCount = _clipper.getClippedVertices().size() >> 1;
+			uvs = &_clipper.getClippedUVs();
+			indices = &_clipper.getClippedTriangles();
+		}
+
+		size_t indicesCount = indices->size();
+		if (indicesCount == 0) {
+			_clipper.clipEnd(slot);
+			continue;
+		}
+
+		BlendMode blendMode = slot.getData().getBlendMode();
+		RenderCommand *command = _commands.size() > 0 ? &_commands[_commands.size() - 1] : NULL;
+		if (!command || command->texture != texture || command->blendMode != blendMode ||
+			command->numVertices + verticesCount > SPINE_COMMAND_VERTEX_COUNT_MAX) {
+			RenderCommand newCommand = {texture, blendMode, _vertices.size(), 0, _indices.size(), 0};
+			_commands.add(newCommand);
+			command = &_commands[_commands.size() - 1];
+		}
+
+		// The color is the same for every vertex of the attachment
+		Color &slotColor = slot.getColor();
+		uint32_t color = packColor(skeletonColor.r * slotColor.r * attachmentColor->r,
+								   skeletonColor.g * slotColor.g * attachmentColor->g,
+								   skeletonColor.b * slotColor.b * attachmentColor->b,
+								   skeletonColor.a * slotColor.a * attachmentColor->a);
+
+		size_t firstVertex = _vertices.size();
+		_vertices.setSize(firstVertex + verticesCount, RenderVertex());
+		RenderVertex *vertex = _vertices.buffer() + firstVertex;
+		float *positions = vertices->buffer(), *texCoords = uvs->buffer();
+		for (size_t ii = 0; ii < verticesCount; ++ii, ++vertex) {
+			vertex->x = positions[ii << 1];
+			vertex->y = positions[(ii << 1) + 1];
+			vertex->u = texCoords[ii << 1];
+			vertex->v = texCoords[(ii << 1) + 1];
+			vertex->color = color;
+		}
+
+		// Rebase the attachment indices onto the vertices of the command
+		unsigned short base = (unsigned short) command->numVertices;
+		size_t firstIndex = _indices.size();
+		_indices.setSize(firstIndex + indicesCount, 0);
+		unsigned short *index = _indices.buffer() + firstIndex, *attachmentIndices = indices->buffer();
+		for (size_t ii = 0; ii < indicesCount; ++ii)
+			index[ii] = (unsigned short) (base + attachmentIndices[ii]);
+
+		command->numVertices += verticesCount;
+		command->numIndices += indicesCount;
+
+		_clipper.clipEnd(slot);
+	}
+	_clipper.clipEnd();
+}
+
+void SkeletonRenderer::setSimplifyMeshes(bool simplify) {
+	_simplifyMeshes = simplify;
+}
+
+bool SkeletonRenderer::getSimplifyMeshes() {
+	return _simplifyMeshes;
+}
+
+void SkeletonRenderer::clear() {
+	_vertices.clear();
+	_indices.clear();
+	_commands.clear();
+}
+
+Vector<RenderVertex> &SkeletonRenderer::getVertices() {
+	return _vertices;
+}
+
+Vector<unsigned short> &SkeletonRenderer::getIndices() {
+	return _indices;
+}
+
+Vector<RenderCommand> &SkeletonRenderer::getCommands() {
+	return _commands;
+}
+
+uint32_t SkeletonRenderer::packColor(float r, float g, float b, float a) {
+	// Assemble the bytes in memory order so the layout does not depend on endianness
+	uint32_t color;
+	uint8_t *bytes = (uint8_t *) &color;
+	bytes[0] = (uint8_t) (r * 255);
+	bytes[1] = (uint8_t) (g * 255);
+	bytes[2] = (uint8_t) (b * 255);
+	bytes[3] = (uint8_t) (a * 255);
+	return color;
+}
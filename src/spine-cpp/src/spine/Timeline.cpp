@@ -36,7 +36,7 @@ namespace spine {
 	RTTI_IMPL_NOPARENT(Timeline)
 
 	Timeline::Timeline(size_t frameCount, size_t frameEntries)
-		: _propertyIds(), _frames(), _frameEntries(frameEntries) {
+		: _propertyIds(), _propertyIndices(), _frames(), _frameEntries(frameEntries) {
 		_frames.setSize(frameCount * frameEntries, 0);
 	}
 
@@ -47,6 +47,10 @@ namespace spine {
 		return _propertyIds;
 	}
 
+	Vector<int> &Timeline::getPropertyIndices() {
+		return _propertyIndices;
+	}
+
 	void Timeline::setPropertyIds(PropertyId propertyIds[], size_t propertyIdsCount) {
 		_propertyIds.clear();
 		_propertyIds.ensureCapacity(propertyIdsCount);
@@ -71,4 +75,8 @@ namespace spine {
 		return _frames[_frames.size() - getFrameEntries()];
 	}
 
+	size_t Timeline::getMemorySize() {
+		return _frames.getCapacity() * sizeof(float);
+	}
+
 }// namespace spine
@@ -64,12 +64,12 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_x = bone->_data._x;
-				bone->_y = bone->_data._y;
+				bone->_x() = bone->_data._x;
+				bone->_y() = bone->_data._y;
 				return;
 			case MixBlend_First:
-				bone->_x += (bone->_data._x - bone->_x) * alpha;
-				bone->_y += (bone->_data._y - bone->_y) * alpha;
+				bone->_x() += (bone->_data._x - bone->_x()) * alpha;
+				bone->_y() += (bone->_data._y - bone->_y()) * alpha;
 			default: {
 			}
 		}
@@ -77,43 +77,21 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	}
 
 	float x = 0, y = 0;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
-	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
-	switch (curveType) {
-		case CurveTimeline::LINEAR: {
-			float before = _frames[i];
-			x = _frames[i + CurveTimeline2::VALUE1];
-			y = _frames[i + CurveTimeline2::VALUE2];
-			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
-			x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
-			y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
-			break;
-		}
-		case CurveTimeline::STEPPED: {
-			x = _frames[i + CurveTimeline2::VALUE1];
-			y = _frames[i + CurveTimeline2::VALUE2];
-			break;
-		}
-		default: {
-			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
-			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline::BEZIER_SIZE - CurveTimeline::BEZIER);
-		}
-	}
+	getCurveValues(time, x, y);
 
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_x = bone->_data._x + x * alpha;
-			bone->_y = bone->_data._y + y * alpha;
+			bone->_x() = bone->_data._x + x * alpha;
+			bone->_y() = bone->_data._y + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_x += (bone->_data._x + x - bone->_x) * alpha;
-			bone->_y += (bone->_data._y + y - bone->_y) * alpha;
+			bone->_x() += (bone->_data._x + x - bone->_x()) * alpha;
+			bone->_y() += (bone->_data._y + y - bone->_y()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_x += x * alpha;
-			bone->_y += y * alpha;
+			bone->_x() += x * alpha;
+			bone->_y() += y * alpha;
 	}
 }
 
@@ -141,10 +119,10 @@ void TranslateXTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_x = bone->_data._x;
+				bone->_x() = bone->_data._x;
 				return;
 			case MixBlend_First:
-				bone->_x += (bone->_data._x - bone->_x) * alpha;
+				bone->_x() += (bone->_data._x - bone->_x()) * alpha;
 			default: {
 			}
 		}
@@ -154,14 +132,14 @@ void TranslateXTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	float x = getCurveValue(time);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_x = bone->_data._x + x * alpha;
+			bone->_x() = bone->_data._x + x * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_x += (bone->_data._x + x - bone->_x) * alpha;
+			bone->_x() += (bone->_data._x + x - bone->_x()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_x += x * alpha;
+			bone->_x() += x * alpha;
 	}
 }
 
@@ -189,10 +167,10 @@ void TranslateYTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_y = bone->_data._y;
+				bone->_y() = bone->_data._y;
 				return;
 			case MixBlend_First:
-				bone->_y += (bone->_data._y - bone->_y) * alpha;
+				bone->_y() += (bone->_data._y - bone->_y()) * alpha;
 			default: {
 			}
 		}
@@ -202,13 +180,13 @@ void TranslateYTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	float y = getCurveValue(time);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_y = bone->_data._y + y * alpha;
+			bone->_y() = bone->_data._y + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_y += (bone->_data._y + y - bone->_y) * alpha;
+			bone->_y() += (bone->_data._y + y - bone->_y()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_y += y * alpha;
+			bone->_y() += y * alpha;
 	}
 }
@@ -69,9 +69,9 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 		if (deformArray->size() > 0) vertices = deformArray;
 
 		Bone &bone = slot._bone;
-		float x = bone._worldX;
-		float y = bone._worldY;
-		float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
+		float x = bone._worldX();
+		float y = bone._worldY();
+		float a = bone._a(), b = bone._b(), c = bone._c(), d = bone._d();
 		for (size_t vv = start, w = offset; w < count; vv += 2, w += stride) {
 			float vx = (*vertices)[vv];
 			float vy = (*vertices)[vv + 1];
@@ -100,8 +100,8 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 				float vx = (*vertices)[b];
 				float vy = (*vertices)[b + 1];
 				float weight = (*vertices)[b + 2];
-				wx += (vx * bone._a + vy * bone._b + bone._worldX) * weight;
-				wy += (vx * bone._c + vy * bone._d + bone._worldY) * weight;
+				wx += (vx * bone._a() + vy * bone._b() + bone._worldX()) * weight;
+				wy += (vx * bone._c() + vy * bone._d() + bone._worldY()) * weight;
 			}
 			worldVertices[w] = wx;
 			worldVertices[w + 1] = wy;
@@ -117,8 +117,8 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 				float vx = (*vertices)[b] + (*deformArray)[f];
 				float vy = (*vertices)[b + 1] + (*deformArray)[f + 1];
 				float weight = (*vertices)[b + 2];
-				wx += (vx * bone._a + vy * bone._b + bone._worldX) * weight;
-				wy += (vx * bone._c + vy * bone._d + bone._worldY) * weight;
+				wx += (vx * bone._a() + vy * bone._b() + bone._worldX()) * weight;
+				wy += (vx * bone._c() + vy * bone._d() + bone._worldY()) * weight;
 			}
 			worldVertices[w] = wx;
 			worldVertices[w + 1] = wy;
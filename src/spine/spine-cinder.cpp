@@ -31,10 +31,16 @@
 
 #include <cinder/Log.h>
 
+#include <algorithm>
+#include <chrono>
+
 #ifndef SPINE_MESH_VERTEX_COUNT_MAX
 #define SPINE_MESH_VERTEX_COUNT_MAX 1000
 #endif
 
+// Streams are indexed with unsigned shorts, a stream is flushed before it exceeds this many vertices
+#define SPINE_BATCH_VERTEX_COUNT_MAX 65535
+
 using namespace ci;
 using namespace ci::app;
 using namespace std;
@@ -49,19 +55,120 @@ ci::BlendMode additivePma = ci::BlendMode(GL_ONE, GL_ONE);
 ci::BlendMode multiplyPma = ci::BlendMode(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA);
 ci::BlendMode screenPma = ci::BlendMode(GL_ONE, GL_ONE_MINUS_SRC_COLOR);
 
+namespace cinder {
+
+    void RenderTarget::setup() {
+        glsl = gl::getStockShader(gl::ShaderDef().texture().color());
+        vertexBuffer = gl::Vbo::create(GL_ARRAY_BUFFER, SPINE_MESH_VERTEX_COUNT_MAX * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+        indexBuffer = gl::Vbo::create(GL_ELEMENT_ARRAY_BUFFER, SPINE_MESH_VERTEX_COUNT_MAX * 3 * sizeof(uint16_t), nullptr, GL_STREAM_DRAW);
+
+        // The vertex layout and the index buffer binding are recorded once in the vao
+        vao = gl::Vao::create();
+        gl::ScopedVao vaoScope(vao);
+        gl::ScopedBuffer vboScope(vertexBuffer);
+        GLint position = glsl->getAttribSemanticLocation(geom::Attrib::POSITION);
+        GLint texCoord = glsl->getAttribSemanticLocation(geom::Attrib::TEX_COORD_0);
+        GLint color = glsl->getAttribSemanticLocation(geom::Attrib::COLOR);
+        gl::enableVertexAttribArray(position);
+        gl::vertexAttribPointer(position, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const GLvoid*)offsetof(Vertex, x));
+        gl::enableVertexAttribArray(texCoord);
+        gl::vertexAttribPointer(texCoord, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const GLvoid*)offsetof(Vertex, u));
+        gl::enableVertexAttribArray(color);
+        gl::vertexAttribPointer(color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (const GLvoid*)offsetof(Vertex, color));
+        indexBuffer->bind();
+    }
+
+    void RenderTarget::upload(gl::VboRef& buffer, const void* data, size_t bytes) {
+        // Orphan the previous storage so the driver does not stall on a buffer still in flight,
+        // growing geometrically so steady state frames never reallocate
+        GLsizeiptr capacity = buffer->getSize();
+        if ((GLsizeiptr)bytes > capacity) capacity = bytes * 2;
+        buffer->bufferData(capacity, nullptr, GL_STREAM_DRAW);
+        buffer->bufferSubData(0, bytes, data);
+    }
+
+    Vertex* RenderTarget::append(const RenderStates& states, size_t numVertices, const uint16_t* indices, size_t numIndices) {
+        // Indices are 16 bit, draw what we have before they would overflow
+        if (vertices.size() + numVertices > SPINE_BATCH_VERTEX_COUNT_MAX) flush();
+
+        mat4 modelMatrix = gl::getModelMatrix();
+        if (runs.empty() || runs.back().states != states || runs.back().modelMatrix != modelMatrix)
+            runs.push_back({ states, modelMatrix, this->indices.size(), 0 });
+        runs.back().numIndices += numIndices;
+
+        // Rebase the attachment indices onto the stream
+        size_t firstVertex = vertices.size();
+        size_t firstIndex = this->indices.size();
+        vertices.resize(firstVertex + numVertices);
+        this->indices.resize(firstIndex + numIndices);
+        uint16_t* index = &this->indices[firstIndex];
+        for (size_t i = 0; i < numIndices; ++i)
+            index[i] = static_cast<uint16_t>(firstVertex + indices[i]);
+
+        return &vertices[firstVertex];
+    }
+
+    void RenderTarget::flush() {
+        if (runs.empty()) return;
+        if (!vao) setup();
+
+        gl::ScopedVao vaoScope(vao);
+        upload(vertexBuffer, vertices.data(), vertices.size() * sizeof(Vertex));
+        upload(indexBuffer, indices.data(), indices.size() * sizeof(uint16_t));
+
+        auto ctx = gl::context();
+        ctx->enable(GL_BLEND);
+
+        gl::ScopedGlslProg glslScope(glsl);
+        gl::ScopedTextureBind texScope(runs.front().states.texture);
+        gl::ScopedModelMatrix modelScope;
+
+        for (size_t i = 0; i < runs.size(); ++i) {
+            const Run& run = runs[i];
+            if (i > 0 && run.states.texture != runs[i - 1].states.texture)
+                run.states.texture->bind();
+            // Each run is drawn with the model matrix its geometry was appended with
+            if (i == 0 || run.modelMatrix != runs[i - 1].modelMatrix) {
+                gl::setModelMatrix(run.modelMatrix);
+                ctx->setDefaultShaderVars();
+            }
+            ctx->blendFunc(run.states.blendMode.src, run.states.blendMode.dst);
+            gl::drawElements(GL_TRIANGLES, (GLsizei)run.numIndices, GL_UNSIGNED_SHORT, (const GLvoid*)(run.firstIndex * sizeof(uint16_t)));
+            ++drawCalls;
+        }
+
+        vertices.clear();
+        indices.clear();
+        runs.clear();
+    }
+
+    void SkeletonBatcher::begin() {
+        resetDrawCalls();
+    }
+
+    void SkeletonBatcher::draw(Drawable& drawable) {
+        drawable.draw(*this, states);
+    }
+
+    void SkeletonBatcher::end() {
+        flush();
+    }
+} /* namespace cinder */
+
 namespace spine {
 
     SkeletonDrawable::SkeletonDrawable(SkeletonData* skeletonData, AnimationStateData* stateData)
         : timeScale(1)
-        , worldVertices()
-        , clipper()
+        , interpolator(nullptr)
+        , renderer()
         , state(nullptr)
         , skeleton(nullptr)
         , usePremultipliedAlpha(false)
+        , lod(nullptr)
+        , lodLevel(0)
         , Drawable()
     {
         Bone::setYDown(true);
-        worldVertices.ensureCapacity(SPINE_MESH_VERTEX_COUNT_MAX);
         skeleton = new (__FILE__, __LINE__) Skeleton(skeletonData);
 
         bounds = new SkeletonBounds();
@@ -70,138 +177,64 @@ namespace spine {
         if (ownsAnimationStateData) stateData = new (__FILE__, __LINE__) AnimationStateData(skeletonData);
 
         state = new (__FILE__, __LINE__) AnimationState(stateData);
-
-        quadIndices.add(0);
-        quadIndices.add(1);
-        quadIndices.add(2);
-        quadIndices.add(2);
-        quadIndices.add(3);
-        quadIndices.add(0);
     }
 
     SkeletonDrawable::~SkeletonDrawable() {
-        // vertexArray takes care of itself (just like worldVertices)
+        // renderer takes care of its own vertices
         if (ownsAnimationStateData) delete state->getData();
         delete state;
+        delete interpolator;
         delete skeleton;
     }
 
     void SkeletonDrawable::update(float deltaTime) {
         if (state && skeleton) {
             state->update(deltaTime * timeScale);
-            state->apply(*skeleton);
-            skeleton->updateWorldTransform();
+            if (!interpolator || interpolator->beginFrame()) {
+                state->apply(*skeleton);
+                skeleton->updateWorldTransform();
+            } else
+                state->applyEvents(*skeleton);
+            if (interpolator) interpolator->endFrame();
             bounds->update(*skeleton, false);
         }
     }
 
-    void SkeletonDrawable::draw(RenderTarget& target, RenderStates& states){
-
-        // Clear
-        vboMesh.clear();
-        // Texture
-        gl::TextureRef texture = nullptr;
-        states.texture = nullptr;
-
-        // Early out if skeleton is invisible
-        if (skeleton->getColor().a == 0) return;
-
-
-        // For each slot in the draw order array of the skeleton
-        for (size_t i = 0, n = skeleton->getSlots().size(); i < n; ++i) {
-            Slot* slot = skeleton->getDrawOrder()[i];
-
-            // Fetch the currently active attachment, continue
-            // with the next slot in the draw order if no
-            // attachment is active on the slot
-            Attachment* attachment = slot->getAttachment();
-            if (!attachment) continue;
-
-            // Fill the vertices array, indices, and texture depending on the type of attachment
-            Vector<float>* vertices = &worldVertices;
-            int verticesCount = 0;
-            Vector<float>* uvs = NULL;
-            Vector<unsigned short>* indices = NULL;
-            int indicesCount = 0;
-            Color* attachmentColor;
-
-            if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
-                // Cast to an spRegionAttachment so we can get the rendererObject
-                // and compute the world vertices
-                RegionAttachment* regionAttachment = (RegionAttachment*)attachment;
-                attachmentColor = &regionAttachment->getColor();
-
-                // Early out if the slot color is 0
-                if (attachmentColor->a == 0) {
-                    clipper.clipEnd(*slot);
-                    continue;
-                }
-
-                // Our engine specific Texture is stored in the AtlasRegion which was
-                // assigned to the attachment on load. It represents the texture atlas
-                // page that contains the image the region attachment is mapped to.
-                texture = *reinterpret_cast<gl::TextureRef*>(((AtlasRegion*)regionAttachment->getRendererObject())->page->getRendererObject());
+    void SkeletonDrawable::setLod(SkeletonLod& lod, size_t level) {
+        if (this->lod == &lod && lodLevel == level) return;
+        lod.apply(level, *skeleton, state, &renderer);
+        this->lod = &lod;
+        lodLevel = level;
+    }
 
-                // Ensure there is enough room for vertices
-                worldVertices.setSize(8, 0);
+    void SkeletonDrawable::setUpdateInterval(int interval, int phase) {
+        if (interpolator)
+            interpolator->setInterval(interval, phase);
+        else
+            interpolator = new (__FILE__, __LINE__) SkeletonInterpolator(*skeleton, state, interval, phase);
+    }
 
-                // Computed the world vertices positions for the 4 vertices that make up
-                // the rectangular region attachment. This assumes the world transform of the
-                // bone to which the slot (and hence attachment) is attached has been calculated
-                // before rendering via Skeleton::updateWorldTransform(). The vertex positions
-                // will be written directoy into the vertices array, with a stride of sizeof(Vertex)
+    void SkeletonDrawable::draw(RenderTarget& target, RenderStates& states) {
+        record();
+        submit(target, states);
+    }
 
-                regionAttachment->computeWorldVertices(*slot, worldVertices, 0, 2);
+    void SkeletonDrawable::record() {
+        renderer.clear();
+        renderer.render(*skeleton);
+    }
 
-                verticesCount = 4;
-                uvs = &regionAttachment->getUVs();
-                indices = &quadIndices;
-                indicesCount = 6;
-            }
-            else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
-                // Cast to an MeshAttachment so we can get the rendererObject
-                // and compute the world vertices
-                MeshAttachment* mesh = (MeshAttachment*)attachment;
-                attachmentColor = &mesh->getColor();
-
-                // Early out if the slot color is 0
-                if (attachmentColor->a == 0) {
-                    clipper.clipEnd(*slot);
-                    continue;
-                }
+    void SkeletonDrawable::submit(RenderTarget& target, RenderStates& states) {
+        Vector<RenderVertex>& vertices = renderer.getVertices();
+        Vector<unsigned short>& indices = renderer.getIndices();
+        Vector<RenderCommand>& commands = renderer.getCommands();
 
-                // Ensure there is enough room for vertices
-                worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
-
-                // Our engine specific Texture is stored in the AtlasRegion which was
-                // assigned to the attachment on load. It represents the texture atlas
-                // page that contains the image the region attachment is mapped to.
-                texture = *reinterpret_cast<gl::TextureRef*>(((AtlasRegion*)mesh->getRendererObject())->page->getRendererObject());
-
-                // Computed the world vertices positions for the vertices that make up
-                // the mesh attachment. This assumes the world transform of the
-                // bone to which the slot (and hence attachment) is attached has been calculated
-                // before rendering via Skeleton::updateWorldTransform(). The vertex positions will
-                // be written directly into the vertices array, with a stride of sizeof(Vertex)
-                size_t numVertices = mesh->getWorldVerticesLength() / 2;
-                mesh->computeWorldVertices(*slot, 0, mesh->getWorldVerticesLength(), worldVertices.buffer(), 0, 2);
-
-                verticesCount = mesh->getWorldVerticesLength() >> 1;
-                uvs = &mesh->getUVs();
-                indices = &mesh->getTriangles();
-                indicesCount = mesh->getTriangles().size();
-            }
-            else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
-                ClippingAttachment* clip = (ClippingAttachment*)slot->getAttachment();
-                clipper.clipStart(*slot, clip);
-                continue;
-            }
-            else
-                continue;
+        for (size_t i = 0, n = commands.size(); i < n; ++i) {
+            RenderCommand& command = commands[i];
 
             ci::BlendMode blend;
             if (!usePremultipliedAlpha) {
-                switch (slot->getData().getBlendMode()) {
+                switch (command.blendMode) {
                 case BlendMode_Normal:
                     blend = normal;
                     break;
@@ -219,7 +252,7 @@ namespace spine {
                 }
             }
             else {
-                switch (slot->getData().getBlendMode()) {
+                switch (command.blendMode) {
                 case BlendMode_Normal:
                     blend = normalPma;
                     break;
@@ -237,48 +270,257 @@ namespace spine {
                 }
             }
 
-            if (states.texture == 0) states.texture = texture;
+            // Our engine specific Texture is stored in the atlas page the attachments of the command are mapped to.
+            // The target merges consecutive geometry sharing these states into one draw call
+            states.blendMode = blend;
+            states.texture = *reinterpret_cast<gl::TextureRef*>(command.texture);
+
+            // The recorded layout is the uploaded layout, the target rebases the command indices onto its stream
+            cinder::Vertex* vertex = target.append(states, command.numVertices, indices.buffer() + command.firstIndex, command.numIndices);
+            memcpy(vertex, vertices.buffer() + command.firstVertex, command.numVertices * sizeof(cinder::Vertex));
+        }
+    }
+
+    static inline uint64_t packRange(size_t begin, size_t end) {
+        return (uint64_t)begin | ((uint64_t)end << 32);
+    }
+
+    SkeletonUpdateScheduler::SkeletonUpdateScheduler(size_t numThreads)
+        : phase(Phase_Update)
+        , deltaTime(0)
+        , generation(0)
+        , running(0)
+        , stopping(false)
+        , groupSkeleton(nullptr)
+        , groupCapacity(0)
+        , readyHead(0)
+        , readyTail(0)
+    {
+        if (numThreads == 0) numThreads = std::max(1u, std::thread::hardware_concurrency());
+        queues.reset(new Queue[numThreads]);
+        for (size_t i = 0; i < numThreads; ++i)
+            queues[i].range = 0;
+        for (int i = 0; i < Phase_Count; ++i)
+            phaseTimes[i] = 0;
+        for (size_t i = 1; i < numThreads; ++i)
+            workers.emplace_back(&SkeletonUpdateScheduler::runWorker, this, i);
+    }
+
+    SkeletonUpdateScheduler::~SkeletonUpdateScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        startCondition.notify_all();
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    void SkeletonUpdateScheduler::add(SkeletonDrawable* drawable) {
+        items.push_back({ nullptr, nullptr, nullptr, drawable, nullptr, 1, true });
+    }
 
-            if (states.blendMode.src != blend.src || states.blendMode.dst != blend.dst || states.texture != texture) {
-                target.draw(vboMesh, states);
-                vboMesh.clear();
-                states.blendMode = blend;
-                states.texture = texture;
+    void SkeletonUpdateScheduler::add(Skeleton* skeleton, AnimationState* state, SkeletonBounds* bounds, float timeScale,
+                                      SkeletonInterpolator* interpolator) {
+        items.push_back({ skeleton, state, bounds, nullptr, interpolator, timeScale, true });
+    }
+
+    void SkeletonUpdateScheduler::clear() {
+        items.clear();
+    }
+
+    void SkeletonUpdateScheduler::update(float deltaTime) {
+        this->deltaTime = deltaTime;
+        for (auto& item : items) {
+            if (item.drawable) {
+                item.skeleton = item.drawable->skeleton;
+                item.state = item.drawable->state;
+                item.bounds = item.drawable->bounds;
+                item.timeScale = item.drawable->timeScale;
+                item.interpolator = item.drawable->interpolator;
+            }
+            item.state->disableQueue();
+        }
+
+        runPhase(Phase_Update);
+        runPhase(Phase_Apply);
+        runPhase(Phase_WorldTransform);
+        runPhase(Phase_Bounds);
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto& item : items) {
+            item.state->enableQueue();
+            item.state->drainQueue();
+        }
+        phaseTimes[Phase_Events] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void SkeletonUpdateScheduler::updateWorldTransform(Skeleton& skeleton) {
+        skeleton.beginUpdateWorldTransform();
+
+        size_t numGroups = skeleton.getUpdateGroupCount();
+        if (numGroups > groupCapacity) {
+            readyGroups.reset(new std::atomic<int>[numGroups]);
+            waitingDependencies.reset(new std::atomic<size_t>[numGroups]);
+            groupCapacity = numGroups;
+        }
+        size_t tail = 0;
+        for (size_t i = 0; i < numGroups; ++i)
+            readyGroups[i] = -1;
+        for (size_t i = 0; i < numGroups; ++i) {
+            waitingDependencies[i] = skeleton.getUpdateGroupDependencyCount(i);
+            if (waitingDependencies[i] == 0) readyGroups[tail++] = (int)i;
+        }
+        readyHead = 0;
+        readyTail = tail;
+        groupSkeleton = &skeleton;
+
+        runPhase(Phase_Groups);
+
+        groupSkeleton = nullptr;
+        skeleton.endUpdateWorldTransform();
+    }
+
+    void SkeletonUpdateScheduler::runPhase(Phase phase) {
+        auto start = std::chrono::steady_clock::now();
+
+        // Each thread starts with a contiguous share of the items
+        size_t numItems = phase == Phase_Groups ? 0 : items.size(), numThreads = getNumThreads();
+        for (size_t i = 0; i < numThreads; ++i)
+            queues[i].range = packRange(numItems * i / numThreads, numItems * (i + 1) / numThreads);
+
+        if (workers.empty()) {
+            this->phase = phase;
+            work(0);
+        }
+        else {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                this->phase = phase;
+                running = workers.size();
+                ++generation;
+            }
+            startCondition.notify_all();
+            work(0);
+            std::unique_lock<std::mutex> lock(mutex);
+            doneCondition.wait(lock, [this] { return running == 0; });
+        }
+
+        phaseTimes[phase] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void SkeletonUpdateScheduler::runWorker(size_t thread) {
+        size_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                startCondition.wait(lock, [this, seen] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
             }
+            work(thread);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--running == 0) doneCondition.notify_one();
+        }
+    }
+
+    void SkeletonUpdateScheduler::work(size_t thread) {
+        if (phase == Phase_Groups) {
+            workGroups();
+            return;
+        }
+
+        size_t index;
+        while (pop(thread, index) || steal(thread, index)) {
+            Item& item = items[index];
+            switch (phase) {
+            case Phase_Update:
+                item.state->update(deltaTime * item.timeScale);
+                item.evaluate = !item.interpolator || item.interpolator->beginFrame();
+                break;
+            case Phase_Apply:
+                if (item.evaluate)
+                    item.state->apply(*item.skeleton);
+                else
+                    item.state->applyEvents(*item.skeleton);
+                break;
+            case Phase_WorldTransform:
+                if (item.evaluate) item.skeleton->updateWorldTransform();
+                if (item.interpolator) item.interpolator->endFrame();
+                break;
+            case Phase_Bounds:
+                if (item.bounds) item.bounds->update(*item.skeleton, false);
+                break;
+            default:
+                break;
+            }
+        }
+    }
 
-            if (clipper.isClipping()) {
-                clipper.clipTriangles(worldVertices, *indices, *uvs, 2);
-                vertices = &clipper.getClippedVertices();
-                verticesCount = clipper.getClippedVertices().size() >> 1;
-                uvs = &clipper.getClippedUVs();
-                indices = &clipper.getClippedTriangles();
-                indicesCount = clipper.getClippedTriangles().size();
+    void SkeletonUpdateScheduler::workGroups() {
+        size_t numGroups = groupSkeleton->getUpdateGroupCount();
+        while (true) {
+            size_t head = readyHead.load();
+            if (head == numGroups) return;
+            // A slot is written when its group becomes ready, wait for a running group to release one
+            int group = readyGroups[head].load(std::memory_order_acquire);
+            if (group < 0) {
+                std::this_thread::yield();
+                continue;
             }
+            if (!readyHead.compare_exchange_weak(head, head + 1)) continue;
+
+            groupSkeleton->updateGroup(group);
 
-            glm::ivec2 size = texture->getSize();
-            uint8_t r = static_cast<uint8_t>(skeleton->getColor().r * slot->getColor().r * attachmentColor->r * 255.f);
-            uint8_t g = static_cast<uint8_t>(skeleton->getColor().g * slot->getColor().g * attachmentColor->g * 255.f);
-            uint8_t b = static_cast<uint8_t>(skeleton->getColor().b * slot->getColor().b * attachmentColor->b * 255.f);
-            uint8_t a = static_cast<uint8_t>(skeleton->getColor().a * slot->getColor().a * attachmentColor->a * 255.f);
-
-            for (uint32_t ii = 0; ii < indicesCount; ++ii) {
-                uint32_t index = (*indices)[ii] << 1;
-                vboMesh.appendPosition(vec3((*vertices)[index], (*vertices)[index + 1], 0.f));
-                vboMesh.appendTexCoord(vec2((*uvs)[index], 1.f - (*uvs)[index + 1]));
-                vboMesh.appendColorRgba(ci::ColorA(r, g, b, a)/255.f);
+            size_t numDependents;
+            int* dependents = groupSkeleton->getUpdateGroupDependents(group, numDependents);
+            for (size_t i = 0; i < numDependents; ++i) {
+                if (waitingDependencies[dependents[i]].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    readyGroups[readyTail.fetch_add(1)].store(dependents[i], std::memory_order_release);
             }
+        }
+    }
 
-            clipper.clipEnd(*slot);
+    bool SkeletonUpdateScheduler::pop(size_t thread, size_t& item) {
+        std::atomic<uint64_t>& range = queues[thread].range;
+        uint64_t current = range.load();
+        while (true) {
+            size_t begin = (uint32_t)current, end = (size_t)(current >> 32);
+            if (begin >= end) return false;
+            if (range.compare_exchange_weak(current, packRange(begin + 1, end))) {
+                item = begin;
+                return true;
+            }
         }
-        target.draw(vboMesh, states);
+    }
 
-        clipper.clipEnd();
+    bool SkeletonUpdateScheduler::steal(size_t thread, size_t& item) {
+        // Only called once the thread's own queue is empty, so the stolen half can be stored there. For a given end the
+        // begin of a range only grows, so a stale range never compares equal and the exchanges are free of ABA.
+        size_t numThreads = getNumThreads();
+        for (size_t i = 1; i < numThreads; ++i) {
+            std::atomic<uint64_t>& range = queues[(thread + i) % numThreads].range;
+            uint64_t current = range.load();
+            while (true) {
+                size_t begin = (uint32_t)current, end = (size_t)(current >> 32);
+                if (begin >= end) break;
+                size_t middle = begin + (end - begin) / 2;
+                if (range.compare_exchange_weak(current, packRange(begin, middle))) {
+                    item = middle;
+                    queues[thread].range = packRange(middle + 1, end);
+                    return true;
+                }
+            }
+        }
+        return false;
     }
+
 	void CINDERTextureLoader::load(AtlasPage &page, const String &path) {
 
 		gl::TextureRef* texture;
 		try {
-			texture = new gl::TextureRef(gl::Texture::create(loadImage(loadFile(path.buffer()))));
+			// Spine texture coordinates have their origin at the top left
+			texture = new gl::TextureRef(gl::Texture::create(loadImage(loadFile(path.buffer())), gl::Texture::Format().loadTopDown()));
 		}
 		catch (Exception& exc) {
 			CI_LOG_EXCEPTION("failed to load image: " << path.buffer(), exc);
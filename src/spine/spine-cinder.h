@@ -36,6 +36,13 @@
 #include "cinder/gl/Texture.h" 
 #include <spine/spine.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 
 namespace cinder {
 
@@ -49,6 +56,8 @@ namespace cinder {
 			, dst(d) {
 
 		}
+		bool operator==(const BlendMode& other) const { return src == other.src && dst == other.dst; }
+		bool operator!=(const BlendMode& other) const { return !(*this == other); }
 		GLenum src;
 		GLenum dst;
 	};
@@ -56,24 +65,54 @@ namespace cinder {
 	class RenderStates {
 	public:
 		RenderStates() {}
+		bool operator==(const RenderStates& other) const { return texture == other.texture && blendMode == other.blendMode; }
+		bool operator!=(const RenderStates& other) const { return !(*this == other); }
 		BlendMode blendMode;
 		ci::gl::TextureRef texture;
 	};
 
+	//! Interleaved vertex layout of the geometry uploaded by a RenderTarget, as recorded by spine::SkeletonRenderer.
+	typedef spine::RenderVertex Vertex;
+
 	class RenderTarget {
 	public:
-		void draw(ci::TriMesh& mesh, RenderStates& states) {
-			auto ctx = gl::context();
-			ctx->enable(GL_BLEND);
-			ctx->blendFunc(states.blendMode.src, states.blendMode.dst);
-
-			// Draw the mesh we created for the attachment
-			gl::ScopedGlslProg glslScope(gl::getStockShader(gl::ShaderDef().texture().color()));
-			gl::ScopedTextureBind texScope(states.texture);
-			gl::pushModelView();
-			gl::draw(mesh);
-			gl::popModelView();
-		}
+		RenderTarget() : drawCalls(0) {}
+
+		//! Appends indexed geometry drawn with the given states to the stream and returns the \a numVertices vertices to fill.
+		//! The geometry is drawn with the model matrix current at the time of the append. Consecutive appends sharing the
+		//! same states and model matrix are merged into a single run.
+		Vertex* append(const RenderStates& states, size_t numVertices, const uint16_t* indices, size_t numIndices);
+
+		//! Uploads the stream into the persistent vertex and index buffers and issues one draw call per run.
+		void flush();
+
+		//! The draw calls issued since the last resetDrawCalls(), which SkeletonBatcher::begin() and Drawable::draw() call.
+		size_t getDrawCalls() const { return drawCalls; }
+
+		void resetDrawCalls() { drawCalls = 0; }
+
+	protected:
+		struct Run {
+			RenderStates states;
+			mat4 modelMatrix;
+			size_t firstIndex;
+			size_t numIndices;
+		};
+
+		//! Creates the persistent buffers and records the vertex layout, requires a GL context.
+		void setup();
+
+		void upload(gl::VboRef& buffer, const void* data, size_t bytes);
+
+		std::vector<Vertex> vertices;
+		std::vector<uint16_t> indices;
+		std::vector<Run> runs;
+		size_t drawCalls;
+
+		gl::GlslProgRef glsl;
+		gl::VaoRef vao;
+		gl::VboRef vertexBuffer;
+		gl::VboRef indexBuffer;
 	};
 
 	class Drawable {
@@ -82,12 +121,32 @@ namespace cinder {
 		virtual ~Drawable() {}
 		virtual void update(float deltaTime) = 0;
 		virtual void draw() {
+			renderTarget.resetDrawCalls();
 			draw(renderTarget, states);
+			renderTarget.flush();
 		}
 		virtual void draw(cinder::RenderTarget& target, cinder::RenderStates& states) = 0;
 		cinder::RenderStates states;
 		cinder::RenderTarget renderTarget;
 	};
+
+	//! Scene level batcher: the geometry of every drawable drawn between begin() and end() is collected into one stream,
+	//! consecutive runs sharing the same texture, blend mode and model matrix across drawables are drawn with a single
+	//! call. Each drawable keeps the model matrix current when it is drawn, eg set with gl::ScopedModelMatrix around
+	//! draw(), drawables sharing one transform batch best.
+	class SkeletonBatcher : public RenderTarget {
+	public:
+		SkeletonBatcher() {}
+
+		void begin();
+
+		void draw(Drawable& drawable);
+
+		void end();
+
+	protected:
+		RenderStates states;
+	};
 } /* namespace cinder */
 
 namespace spine {
@@ -102,29 +161,146 @@ namespace spine {
 
 		virtual void draw(cinder::RenderTarget& target, cinder::RenderStates& states);
 
+		//! Records the skeleton's geometry without touching OpenGL, may be called off the GL thread.
+		void record();
+
+		//! Appends the geometry recorded by the last call to record() to the target.
+		void submit(cinder::RenderTarget& target, cinder::RenderStates& states);
+
+		SkeletonRenderer& getRenderer() { return renderer; }
+
 		void setUsePremultipliedAlpha(bool usePMA) { usePremultipliedAlpha = usePMA; };
 
 		bool getUsePremultipliedAlpha() { return usePremultipliedAlpha; };
 
+		//! Switches the skeleton, state and renderer to a level of detail, eg to lod.getLevel(*bounds, zoom) before
+		//! each update(). Does nothing if the level is already applied.
+		void setLod(SkeletonLod& lod, size_t level);
+
+		size_t getLodLevel() { return lodLevel; }
+
+		//! Evaluates the skeleton only every \a interval frames and interpolates its world transforms in between, see
+		//! SkeletonInterpolator. Use a different \a phase for the skeletons of a crowd to spread their evaluations.
+		//! Slot attachments, colors, deforms and the draw order are not interpolated and change ahead of the bones, so
+		//! intervals are meant for crowds whose animations do not key them.
+		void setUpdateInterval(int interval, int phase = 0);
+
 		Skeleton* skeleton;
 		SkeletonBounds* bounds;
 		AnimationState* state;
 		float timeScale;
-
-		// Mesh
-		ci::TriMesh vboMesh = ci::TriMesh(
-			ci::TriMesh::Format()
-			.positions()
-			.texCoords0()
-			.colors(4)
-		);
+		//! Null unless setUpdateInterval() was called.
+		SkeletonInterpolator* interpolator;
 
 	protected:
 		bool ownsAnimationStateData;
-		Vector<float> worldVertices;
-		Vector<unsigned short> quadIndices;
-		SkeletonClipping clipper;
+		SkeletonRenderer renderer;
 		bool usePremultipliedAlpha;
+		SkeletonLod* lod;
+		size_t lodLevel;
+	};
+
+	//! Updates many skeletons in parallel. Each phase of SkeletonDrawable::update(), AnimationState::update(), apply(),
+	//! Skeleton::updateWorldTransform() and SkeletonBounds::update(), runs over all skeletons on a pool of threads that
+	//! steal work from each other, the calling thread takes part. Listeners are not called while the phases run, the
+	//! queued events are drained afterwards on the calling thread, state by state in the order the skeletons were added.
+	//! A listener that sets an animation on a complete event thus changes the pose one update later than it would with
+	//! SkeletonDrawable::update(). The phases allocate and free through the installed SpineExtension on the worker
+	//! threads, so it must be thread-safe. DefaultSpineExtension is, DebugExtension is not and must not be installed
+	//! while a scheduler updates.
+	class SkeletonUpdateScheduler {
+	public:
+		enum Phase {
+			Phase_Update,
+			Phase_Apply,
+			Phase_WorldTransform,
+			Phase_Bounds,
+			Phase_Events,
+			//! updateWorldTransform(Skeleton&).
+			Phase_Groups,
+			Phase_Count
+		};
+
+		//! Starts \a numThreads - 1 worker threads, or one less than the number of hardware threads when 0.
+		explicit SkeletonUpdateScheduler(size_t numThreads = 0);
+
+		~SkeletonUpdateScheduler();
+
+		//! Updates the drawable's skeleton, state and bounds with its time scale, as SkeletonDrawable::update() does.
+		void add(SkeletonDrawable* drawable);
+
+		//! \a bounds and \a interpolator may be null.
+		void add(Skeleton* skeleton, AnimationState* state, SkeletonBounds* bounds = nullptr, float timeScale = 1,
+				 SkeletonInterpolator* interpolator = nullptr);
+
+		void clear();
+
+		//! Runs all phases for all skeletons and then calls the listeners for their events.
+		void update(float deltaTime);
+
+		//! Computes the world transforms of a single skeleton, updating the groups of its update cache that do not depend
+		//! on each other in parallel, see Skeleton::updateGroup(). Pays off for skeletons with hundreds of bones.
+		void updateWorldTransform(Skeleton& skeleton);
+
+		//! The wall clock seconds the phase took in the last update().
+		double getPhaseTime(Phase phase) const { return phaseTimes[phase]; }
+
+		size_t getNumThreads() const { return workers.size() + 1; }
+
+	protected:
+		struct Item {
+			Skeleton* skeleton;
+			AnimationState* state;
+			SkeletonBounds* bounds;
+			SkeletonDrawable* drawable;
+			SkeletonInterpolator* interpolator;
+			float timeScale;
+			//! Whether the skeleton is evaluated in this update, see SkeletonInterpolator::beginFrame().
+			bool evaluate;
+		};
+
+		//! The item indices a thread has left in the current phase, begin in the low and end in the high 32 bits. The
+		//! owner takes items from the front, other threads steal the back half. Padded so queues don't share cache lines.
+		struct Queue {
+			std::atomic<uint64_t> range;
+			char padding[64 - sizeof(std::atomic<uint64_t>)];
+		};
+
+		void runPhase(Phase phase);
+
+		//! Runs items of the current phase until no thread has any left.
+		void work(size_t thread);
+
+		//! Updates groups of the current skeleton as they become ready until all are taken.
+		void workGroups();
+
+		bool pop(size_t thread, size_t& item);
+
+		bool steal(size_t thread, size_t& item);
+
+		void runWorker(size_t thread);
+
+		std::vector<Item> items;
+		std::vector<std::thread> workers;
+		std::unique_ptr<Queue[]> queues;
+		std::mutex mutex;
+		std::condition_variable startCondition;
+		std::condition_variable doneCondition;
+		Phase phase;
+		float deltaTime;
+		size_t generation;
+		size_t running;
+		bool stopping;
+		double phaseTimes[Phase_Count];
+
+		//! The groups whose dependencies are updated, in the order they became ready, and the number of dependencies
+		//! each group still waits for. Groups are taken from readyHead and added at readyTail.
+		Skeleton* groupSkeleton;
+		std::unique_ptr<std::atomic<int>[]> readyGroups;
+		std::unique_ptr<std::atomic<size_t>[]> waitingDependencies;
+		size_t groupCapacity;
+		std::atomic<size_t> readyHead;
+		std::atomic<size_t> readyTail;
 	};
 
 	class CINDERTextureLoader : public TextureLoader {